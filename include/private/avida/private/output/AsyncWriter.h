@@ -0,0 +1,119 @@
+/*
+ *  private/output/AsyncWriter.h
+ *  avida-core
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaOutputAsyncWriter_h
+#define AvidaOutputAsyncWriter_h
+
+#include "apto/core/Thread.h"
+#include "avida/output/Types.h"
+
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+
+namespace Avida {
+  namespace Output {
+
+    // Output::AsyncWriter - Background thread that writes buffered file data to disk in submission order
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    //  Files hand off formatted data as chunks.  Chunks are written strictly in the order they were submitted, each
+    //  submission returns a ticket that can be passed to Sync() to wait until that chunk (and everything before it)
+    //  has reached the stream.  Submit() blocks only when more than the configured number of bytes are waiting.
+
+    class AsyncWriter : public Apto::RefCountObject<Apto::ThreadSafe>
+    {
+    public:
+      typedef unsigned long long Ticket;
+
+    private:
+      struct Chunk
+      {
+        std::ofstream* fp;
+        OutputID name;
+        std::string data;
+      };
+
+      class WriterThread : public Apto::Thread
+      {
+      private:
+        AsyncWriter* m_writer;
+
+        void Run() { m_writer->run(); }
+
+      public:
+        WriterThread(AsyncWriter* writer) : m_writer(writer) { ; }
+      };
+
+
+      WriterThread* m_thread;
+
+      mutable Apto::Mutex m_mutex;
+      Apto::ConditionVariable m_work_cond;    // signalled when chunks are queued or on shutdown
+      Apto::ConditionVariable m_space_cond;   // signalled when queued bytes drop
+      Apto::ConditionVariable m_done_cond;    // signalled when chunks complete
+
+      std::vector<Chunk> m_pending;
+      size_t m_queued_bytes;
+      size_t m_max_queued_bytes;
+      Ticket m_submitted;
+      Ticket m_completed;
+      bool m_shutdown;
+
+      std::set<const std::ofstream*> m_failed;
+      Apto::String m_error;
+      bool m_error_pending;
+
+
+      AsyncWriter(); // @not_implemented
+      AsyncWriter(const AsyncWriter&); // @not_implemented
+      AsyncWriter& operator=(const AsyncWriter&); // @not_implemented
+
+    public:
+      LIB_LOCAL AsyncWriter(size_t max_queued_bytes);
+      LIB_LOCAL ~AsyncWriter();
+
+      // Queue data for writing to fp, taking the contents of data (left empty on return)
+      LIB_LOCAL Ticket Submit(std::ofstream* fp, const OutputID& name, std::string& data);
+
+      LIB_LOCAL void Sync(Ticket ticket);
+      LIB_LOCAL void SyncAll();
+
+      LIB_LOCAL bool HasFailed(const std::ofstream* fp) const;
+      LIB_LOCAL void Release(const std::ofstream* fp);
+
+      // Retrieves the first write error not yet reported, if any
+      LIB_LOCAL bool TakeError(Apto::String& message);
+
+      // Writes all queued data and stops the writer thread, subsequent submissions are written immediately
+      LIB_LOCAL void Shutdown();
+
+    private:
+      LIB_LOCAL void run();
+    };
+
+  };
+};
+
+#endif
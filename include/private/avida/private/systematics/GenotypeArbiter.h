@@ -57,6 +57,7 @@ namespace Avida {
       Apto::List<GenotypePtr, Apto::SparseVector> m_active_hash[HASH_SIZE];
       Apto::Array<Apto::List<GenotypePtr, Apto::SparseVector>, Apto::ManagedPointer> m_active_sz;
       Apto::List<GenotypePtr, Apto::SparseVector> m_historic;
+      Apto::Map<int, GenotypePtr> m_active_ids;      // active genotypes by ID, mirrors m_active_hash
       GenotypePtr m_coalescent;
       int m_best;
       int m_next_id;
@@ -107,12 +108,20 @@ namespace Avida {
       {
         Apto::String description;
         Apto::Functor<Data::PackagePtr, Apto::NullType> GetData;
+        int slot;
         
-        ProvidedData() { ; }
-        ProvidedData(const Apto::String& desc, Apto::Functor<Data::PackagePtr, Apto::NullType> func)
-          : description(desc), GetData(func) { ; } 
+        ProvidedData() : slot(-1) { ; }
+        ProvidedData(const Apto::String& desc, Apto::Functor<Data::PackagePtr, Apto::NullType> func, int in_slot)
+          : description(desc), GetData(func), slot(in_slot) { ; } 
+      };
+      struct TypedSlot
+      {
+        Data::ValueType type;
+        const int* int_value;
+        const double* double_value;
       };
       Apto::Map<Data::DataID, ProvidedData> m_provided_data;
+      Apto::Array<TypedSlot> m_typed_slots;
       mutable Data::ConstDataSetPtr m_provides;
       
       
@@ -138,6 +147,9 @@ namespace Avida {
       void UpdateProvidedValues(Update current_update);
       Data::PackagePtr GetProvidedValue(const Data::DataID& data_id) const;
       Apto::String DescribeProvidedValue(const Data::DataID& data_id) const;
+      int ResolveProvidedSlot(const Data::DataID& data_id, Data::ValueType& type) const;
+      int ProvidedIntValue(int slot) const;
+      double ProvidedDoubleValue(int slot) const;
       
       
     private:
@@ -154,6 +166,8 @@ namespace Avida {
     private:
       void setupProvidedData(World* world);
       template <class T> Data::PackagePtr packageData(const T&) const;
+      int addTypedSlot(const int& val);
+      int addTypedSlot(const double& val);
       Data::ProviderPtr activateProvider(World*);
       
       unsigned int hashGenome(const InstructionSequence& genome) const;
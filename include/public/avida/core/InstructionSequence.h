@@ -64,17 +64,35 @@ namespace Avida {
   
   // InstructionSequence - a series of bytes containing a base level genetic sequence
   // --------------------------------------------------------------------------------------------------------------
+  //
+  //  Copies share the instruction storage of the sequence they were made from.  Storage is reference counted and
+  //  copied on the first write to a sequence that does not hold it exclusively, so all writes must go through
+  //  writableSeq().  Every write path also widens the modified range (markModified()), which lets consumers such as
+  //  cLabelIndex reexamine only the sites that may have changed.  Non-const access is assumed to be a write.
 
   class InstructionSequence : public GeneticRepresentation
   {
   protected:
-    Apto::Array<Instruction> m_seq;
+    class InstructionBuffer : public Apto::Array<Instruction>, public Apto::RefCountObject<Apto::ThreadSafe>
+    {
+    public:
+      inline explicit InstructionBuffer(int size = 0) : Apto::Array<Instruction>(size) { ; }
+      ~InstructionBuffer() { ; }
+    };
+    typedef Apto::SmartPtr<InstructionBuffer, Apto::InternalRCObject> InstructionBufferPtr;
+    
+    InstructionBufferPtr m_seq;
     int m_active_size;
     
+    // Range of sites that may have changed since the last ClearModified(), sites outside of it are unchanged
+    int m_mod_begin;
+    int m_mod_end;
+    
   public:
-    LIB_EXPORT inline InstructionSequence() : m_active_size(0) { ; }
+    LIB_EXPORT inline InstructionSequence() : m_seq(new InstructionBuffer), m_active_size(0), m_mod_begin(0), m_mod_end(0) { ; }
     LIB_EXPORT InstructionSequence(const InstructionSequence& seq);
-    LIB_EXPORT inline explicit InstructionSequence(int size) : m_seq(size), m_active_size(size) { ; }
+    LIB_EXPORT inline explicit InstructionSequence(int size)
+      : m_seq(new InstructionBuffer(size)), m_active_size(size), m_mod_begin(0), m_mod_end(size) { ; }
     LIB_EXPORT explicit InstructionSequence(const Apto::String& str);
     LIB_EXPORT virtual ~InstructionSequence();
     
@@ -82,8 +100,13 @@ namespace Avida {
     // Accessors
     LIB_EXPORT inline int GetSize() const { return m_active_size; }
     
-    LIB_EXPORT inline Instruction& operator[](int idx) { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
-    LIB_EXPORT inline const Instruction& operator[](int idx) const { assert(idx >= 0 && idx < m_active_size);  return m_seq[idx]; }
+    LIB_EXPORT inline Instruction& operator[](int idx)
+      { assert(idx >= 0 && idx < m_active_size); markModified(idx, idx + 1); return writableSeq()[idx]; }
+    LIB_EXPORT inline const Instruction& operator[](int idx) const { assert(idx >= 0 && idx < m_active_size);  return (*m_seq)[idx]; }
+    
+    LIB_EXPORT inline int GetModifiedBegin() const { return m_mod_begin; }
+    LIB_EXPORT inline int GetModifiedEnd() const { return (m_mod_end < m_active_size) ? m_mod_end : m_active_size; }
+    LIB_EXPORT inline void ClearModified() { m_mod_begin = m_active_size; m_mod_end = 0; }
 
 
     // GeneticRepresentation Interface
@@ -141,6 +164,15 @@ namespace Avida {
   protected:
     LIB_EXPORT virtual void adjustCapacity(int new_size);
     LIB_EXPORT virtual void prepareInsert(int pos, int num_sites);
+    
+    inline Apto::Array<Instruction>& writableSeq() { if (!m_seq->IsExclusive()) copyOnWrite(); return *m_seq; }
+    LIB_EXPORT void copyOnWrite();
+    
+    inline void markModified(int begin, int end)
+    {
+      if (begin < m_mod_begin) m_mod_begin = begin;
+      if (end > m_mod_end) m_mod_end = end;
+    }
   };
 
 
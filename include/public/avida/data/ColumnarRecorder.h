@@ -0,0 +1,189 @@
+/*
+ *  data/ColumnarRecorder.h
+ *  avida-core
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AvidaDataColumnarRecorder_h
+#define AvidaDataColumnarRecorder_h
+
+#include "apto/core/Array.h"
+#include "avida/core/Types.h"
+#include "avida/data/Recorder.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+
+namespace Avida {
+  namespace Data {
+
+    // Binary columnar time-series format
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    //  All values are stored in the byte order of the writing machine, identified by the byte order mark.
+    //
+    //  header:  char[8] "AVDCOL02", uint32 byte order mark (0x01020304), uint32 column count,
+    //           per column: uint32 name length, name bytes, then uint8 ColumnType[column count]
+    //  block:   uint32 row count, uint8 BlockEncoding, uint32 raw payload size, uint32 stored payload size, payload
+    //  payload: int32 update[rows], then for each column its values for all rows - int32, float64, int64, uint64
+    //           or (uint32 length, bytes) for strings
+    //
+    //  The header is written when the file is opened, with every column COLUMN_UNTYPED.  The types are filled in
+    //  once the first row arrives, so a file without any blocks may still be untyped.
+
+    enum ColumnType {
+      COLUMN_INT = 0,
+      COLUMN_DOUBLE,
+      COLUMN_STRING,
+      COLUMN_INT64,
+      COLUMN_UINT64,
+      
+      COLUMN_UNTYPED = 255
+    };
+
+    enum BlockEncoding {
+      BLOCK_RAW = 0,
+      BLOCK_ZLIB
+    };
+
+
+    // Data::ColumnarRecorder - Records a fixed set of data values into the binary columnar format
+    // --------------------------------------------------------------------------------------------------------------
+    //
+    //  A row is recorded at the first update the recorder is notified of, and then every interval updates after it.
+    //  Column types are taken from the values supplied at the first recorded update, aggregate and unrecognized
+    //  values are stored as strings.  Long and unsigned values keep their full width as 64-bit columns.  Values are
+    //  collected through a row recording plan, so typed values are copied straight into the column buffers.  Rows are
+    //  accumulated in memory and written out a block at a time.
+
+    class ColumnarRecorder : public Recorder
+    {
+    private:
+      struct Column
+      {
+        DataID data_id;
+        ColumnType type;
+        Apto::Array<int, Apto::Smart> ints;
+        Apto::Array<double, Apto::Smart> doubles;
+        Apto::Array<Apto::String, Apto::Smart> strings;
+        Apto::Array<long long, Apto::Smart> int64s;
+        Apto::Array<unsigned long long, Apto::Smart> uint64s;
+      };
+
+      std::ofstream m_fp;
+      ConstDataSetPtr m_requested;
+      Apto::Array<Column> m_columns;
+      Apto::Array<Update, Apto::Smart> m_updates;
+
+      Update m_interval;
+      Update m_first_update;              // update of the first recorded row, -1 until then
+      int m_block_rows;
+      bool m_compress;
+      bool m_types_written;
+      std::streampos m_types_offset;      // location of the column type array in the header
+
+      Apto::Array<DataID> m_layout;
+
+
+      ColumnarRecorder(); // @not_implemented
+      ColumnarRecorder(const ColumnarRecorder&); // @not_implemented
+      ColumnarRecorder& operator=(const ColumnarRecorder&); // @not_implemented
+
+    public:
+      LIB_EXPORT ColumnarRecorder(const Apto::String& path, const Apto::Array<DataID>& data_ids, Update interval = 1,
+                                  int block_rows = 256, bool compress = false);
+      LIB_EXPORT ~ColumnarRecorder();
+
+      LIB_EXPORT inline bool Good() const { return m_fp.good(); }
+
+      // Data::Recorder Interface
+      LIB_EXPORT inline ConstDataSetPtr RequestedData() const { return m_requested; }
+      LIB_EXPORT void NotifyData(Update current_update, DataRetrievalFunctor retrieve_data);
+      LIB_EXPORT inline const Apto::Array<DataID>* RowLayout() const { return &m_layout; }
+      LIB_EXPORT void NotifyRow(Update current_update, const Row& row);
+
+      LIB_EXPORT void Flush(); // Writes all accumulated rows as a (possibly short) block
+
+      LIB_EXPORT static bool CompressionAvailable();
+
+    private:
+      LIB_LOCAL void writeHeader();
+      LIB_LOCAL void writeTypes();
+      LIB_LOCAL void clearColumns();
+      LIB_LOCAL bool recordsUpdate(Update current_update);
+    };
+
+
+    // Data::ColumnarReader - Reads the binary columnar format one block at a time
+    // --------------------------------------------------------------------------------------------------------------
+
+    class ColumnarReader
+    {
+    private:
+      struct Column
+      {
+        DataID data_id;
+        ColumnType type;
+        Apto::Array<int, Apto::Smart> ints;
+        Apto::Array<double, Apto::Smart> doubles;
+        Apto::Array<Apto::String, Apto::Smart> strings;
+        Apto::Array<long long, Apto::Smart> int64s;
+        Apto::Array<unsigned long long, Apto::Smart> uint64s;
+      };
+
+      std::ifstream m_fp;
+      Apto::Array<Column> m_columns;
+      Apto::Array<Update, Apto::Smart> m_updates;
+      Apto::String m_error;
+
+
+      ColumnarReader(const ColumnarReader&); // @not_implemented
+      ColumnarReader& operator=(const ColumnarReader&); // @not_implemented
+
+    public:
+      LIB_EXPORT ColumnarReader() { ; }
+
+      LIB_EXPORT bool Open(const Apto::String& path);
+      LIB_EXPORT inline const Apto::String& Error() const { return m_error; }
+
+      LIB_EXPORT inline int NumColumns() const { return m_columns.GetSize(); }
+      LIB_EXPORT inline const DataID& ColumnDataID(int col) const { return m_columns[col].data_id; }
+      LIB_EXPORT inline ColumnType ColumnTypeOf(int col) const { return m_columns[col].type; }
+
+      // Loads the next block, returns false at end of file or on error (check Error())
+      LIB_EXPORT bool ReadBlock();
+
+      LIB_EXPORT inline int NumRows() const { return m_updates.GetSize(); }
+      LIB_EXPORT inline Update RowUpdate(int row) const { return m_updates[row]; }
+      LIB_EXPORT inline int IntValue(int col, int row) const { return m_columns[col].ints[row]; }
+      LIB_EXPORT inline long long Int64Value(int col, int row) const { return m_columns[col].int64s[row]; }
+      LIB_EXPORT inline unsigned long long UInt64Value(int col, int row) const { return m_columns[col].uint64s[row]; }
+      LIB_EXPORT inline double DoubleValue(int col, int row) const { return m_columns[col].doubles[row]; }
+      LIB_EXPORT inline const Apto::String& StringValue(int col, int row) const { return m_columns[col].strings[row]; }
+
+      // Writes the remaining blocks in the whitespace delimited layout used by Output::File
+      LIB_EXPORT bool ExportText(std::ostream& out);
+    };
+
+  };
+};
+
+#endif
@@ -43,6 +43,8 @@ namespace Avida {
       typedef Apto::Set<Apto::String, Apto::DefaultHashBTree, Apto::Multi> ArgMultiSet;
       typedef Apto::SmartPtr<ArgMultiSet> ArgMultiSetPtr;
       
+      struct RecordingPlan;
+      
     private:
       World* m_world;
       
@@ -54,6 +56,7 @@ namespace Avida {
       
       mutable Apto::Mutex m_recorder_mutex;
       Apto::Set<RecorderPtr> m_recorders;
+      Apto::Array<RecordingPlan*> m_plans;  // row recorders, held here instead of in m_recorders
       
       Apto::Array<ProviderPtr> m_active_providers;
       Apto::Array<ArgumentedProviderPtr> m_active_arg_providers;
@@ -95,6 +98,10 @@ namespace Avida {
       
     public:
       LIB_LOCAL PackagePtr GetCurrentValue(const DataID& data_id) const;
+      
+    private:
+      LIB_LOCAL RecordingPlan* compilePlan(RecorderPtr recorder, const Apto::Array<DataID>& layout) const;
+      LIB_LOCAL void collectRow(RecordingPlan& plan) const;
     };
     
   };
@@ -66,6 +66,8 @@ namespace Avida {
     public:
       LIB_EXPORT inline Wrap(T value) : m_value(value) { ; }
       
+      LIB_EXPORT inline const T& Value() const { return m_value; }
+      
       LIB_EXPORT bool BoolValue() const { return m_value; }
       LIB_EXPORT int IntValue() const { return m_value; }
       LIB_EXPORT double DoubleValue() const { return m_value; }
@@ -48,6 +48,13 @@ namespace Avida {
       LIB_EXPORT virtual Apto::String DescribeProvidedValue(const DataID& data_id) const = 0;
       
       LIB_EXPORT virtual bool SupportsConcurrentUpdate() const;
+      
+      // Typed value access - a provider that can report a value without packaging it resolves the data id to a slot
+      // (and sets type), which can then be read directly every update.  Returns -1 when the value is only available
+      // through GetProvidedValue, which is the default.
+      LIB_EXPORT virtual int ResolveProvidedSlot(const DataID& data_id, ValueType& type) const;
+      LIB_EXPORT virtual int ProvidedIntValue(int slot) const;
+      LIB_EXPORT virtual double ProvidedDoubleValue(int slot) const;
     };
     
     
@@ -25,8 +25,11 @@
 #ifndef AvidaDataRecorder_h
 #define AvidaDataRecorder_h
 
+#include "apto/core/Array.h"
+#include "apto/core/StringUtils.h"
 #include "apto/platform.h"
 #include "avida/core/Types.h"
+#include "avida/data/Package.h"
 #include "avida/data/Types.h"
 
 
@@ -44,8 +47,77 @@ namespace Avida {
       LIB_EXPORT virtual ConstDataSetPtr RequestedData() const = 0;
       
       LIB_EXPORT virtual void NotifyData(Update current_update, DataRetrievalFunctor retrieve_data) = 0; 
+      
+      // Row recording - a recorder that returns a layout here is notified through NotifyRow() instead of NotifyData().
+      // The layout is compiled into a recording plan when the recorder is attached, and every update the values are
+      // collected into a row buffer that is reused for the life of the recorder.
+      LIB_EXPORT virtual const Apto::Array<DataID>* RowLayout() const;
+      LIB_EXPORT virtual void NotifyRow(Update current_update, const Row& row);
     };
     
+    
+    // Data::Row - Typed values of a single update, in the order of the recorder's row layout
+    // --------------------------------------------------------------------------------------------------------------
+    
+    class Row
+    {
+    private:
+      Apto::Array<ValueType, Apto::Smart> m_types;
+      Apto::Array<int, Apto::Smart> m_ints;
+      Apto::Array<double, Apto::Smart> m_doubles;
+      Apto::Array<PackagePtr> m_packages;
+      
+      
+      Row(const Row&); // @not_implemented
+      Row& operator=(const Row&); // @not_implemented
+      
+    public:
+      LIB_EXPORT inline Row() { ; }
+      
+      LIB_EXPORT inline int GetSize() const { return m_types.GetSize(); }
+      LIB_EXPORT inline ValueType TypeOf(int idx) const { return m_types[idx]; }
+      
+      LIB_EXPORT inline int IntValue(int idx) const;
+      LIB_EXPORT inline double DoubleValue(int idx) const;
+      LIB_EXPORT inline Apto::String StringValue(int idx) const;
+      LIB_EXPORT inline ConstPackagePtr PackageValue(int idx) const { return m_packages[idx]; }
+      
+      // Row construction, used by the data manager
+      LIB_LOCAL void Resize(int size);
+      LIB_LOCAL inline void SetType(int idx, ValueType type) { m_types[idx] = type; }
+      LIB_LOCAL inline void SetInt(int idx, int value) { m_ints[idx] = value; }
+      LIB_LOCAL inline void SetDouble(int idx, double value) { m_doubles[idx] = value; }
+      LIB_LOCAL inline void SetPackage(int idx, PackagePtr value) { m_packages[idx] = value; }
+    };
+    
+    
+    inline int Row::IntValue(int idx) const
+    {
+      switch (m_types[idx]) {
+        case VALUE_INT:    return m_ints[idx];
+        case VALUE_DOUBLE: return (int)m_doubles[idx];
+        default:           return (m_packages[idx]) ? m_packages[idx]->IntValue() : 0;
+      }
+    }
+    
+    inline double Row::DoubleValue(int idx) const
+    {
+      switch (m_types[idx]) {
+        case VALUE_INT:    return m_ints[idx];
+        case VALUE_DOUBLE: return m_doubles[idx];
+        default:           return (m_packages[idx]) ? m_packages[idx]->DoubleValue() : 0.0;
+      }
+    }
+    
+    inline Apto::String Row::StringValue(int idx) const
+    {
+      switch (m_types[idx]) {
+        case VALUE_INT:    return Apto::AsStr(m_ints[idx]);
+        case VALUE_DOUBLE: return Apto::AsStr(m_doubles[idx]);
+        default:           return (m_packages[idx]) ? m_packages[idx]->StringValue() : Apto::String("");
+      }
+    }
+    
   };
 };
 
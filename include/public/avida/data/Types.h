@@ -38,6 +38,7 @@ namespace Avida {
     class Package;
     class Provider;    
     class Recorder;
+    class Row;
 
     
     // Type Declarations
@@ -67,6 +68,16 @@ namespace Avida {
     typedef Apto::Functor<PackagePtr, Apto::TL::Create<const DataID&>, SmallObjectMalloc> DataRetrievalFunctor;
     
     typedef Apto::SmartPtr<Manager, Apto::InternalRCObject> ManagerPtr;
+    
+    
+    // Enumerations
+    // --------------------------------------------------------------------------------------------------------------
+    
+    enum ValueType {
+      VALUE_PACKAGE = 0,  // value is only available as a package
+      VALUE_INT,
+      VALUE_DOUBLE
+    };
   };
 };
 
@@ -27,6 +27,7 @@
 
 #include "apto/core.h"
 #include "avida/core/Types.h"
+#include "avida/data/Types.h"
 
 namespace Avida {
   namespace Data {
@@ -40,6 +41,19 @@ namespace Avida {
     {
       return (data_id.GetSize() > 2 && data_id[data_id.GetSize() - 1] == ']');
     }
+    
+    // Separates an argumented data id "name[arg]" into its raw id "name[]" and argument, returns false if malformed
+    inline bool SplitArgumentedID(const DataID& data_id, DataID& raw_id, Argument& argument)
+    {
+      for (int i = 0; i < data_id.GetSize(); i++) {
+        if (data_id[i] == '[') {
+          argument = data_id.Substring(i + 1, data_id.GetSize() - i - 2);
+          raw_id = data_id.Substring(0, i + 1) + "]";
+          return true;
+        }
+      }
+      return false;
+    }
 
   };
 };
@@ -49,6 +49,13 @@ namespace Avida {
       int m_num_cols;
       
       std::ofstream m_fp;
+      
+      // Asynchronous mode - rows are formatted into m_buffer and handed off to the output manager's writer thread
+      AsyncWriterPtr m_writer;
+      std::ostringstream m_buffer;
+      unsigned long long m_ticket;
+      bool m_async;
+      std::ostream* m_out;
 
       
     public:
@@ -70,14 +77,15 @@ namespace Avida {
       LIB_EXPORT inline const OutputID& Name() const { return m_output_id; }
       LIB_EXPORT inline const Apto::String& GetFileType() const { return m_filetype; }
       
-      LIB_EXPORT inline bool Fail() const { return m_fp.fail(); }
-      LIB_EXPORT inline bool Good() const { return m_fp.good(); }
+      LIB_EXPORT bool Fail() const;
+      LIB_EXPORT bool Good() const;
       LIB_EXPORT inline bool HeaderDone() { return m_descr_written; }
       
       LIB_EXPORT inline bool SetFileType(const Apto::String& ft);
 
       
-      LIB_EXPORT inline std::ofstream& OFStream() { return m_fp; }
+      // Direct stream access switches an asynchronous file back to synchronous writes (after draining queued data)
+      LIB_EXPORT inline std::ofstream& OFStream() { if (m_async) stopAsync(); return m_fp; }
       
       
       // The following methods output a value into the data file.
@@ -94,10 +102,10 @@ namespace Avida {
       
       // The following methods output a value into the data file anonymously (no column descriptor).
       //  first argument (x, i, data_str, etc.) - the value to write (as double, int, const char *, etc.)
-      LIB_EXPORT inline void WriteAnonymous(double x) { m_fp << x << " "; }
-      LIB_EXPORT inline void WriteAnonymous(int i) { m_fp << i << " "; }
-      LIB_EXPORT inline void WriteAnonymous(long i) { m_fp << i << " "; }
-      LIB_EXPORT inline void WriteAnonymous(const char* data_str) { m_fp << data_str << " "; }
+      LIB_EXPORT inline void WriteAnonymous(double x) { *m_out << x << " "; }
+      LIB_EXPORT inline void WriteAnonymous(int i) { *m_out << i << " "; }
+      LIB_EXPORT inline void WriteAnonymous(long i) { *m_out << i << " "; }
+      LIB_EXPORT inline void WriteAnonymous(const char* data_str) { *m_out << data_str << " "; }
       
       // The following methods are useful for outputting tables of values with row size x
       LIB_EXPORT void WriteBlockElement(double x, int element, int x_size);
@@ -118,13 +126,16 @@ namespace Avida {
       LIB_EXPORT void Endl(); // Write all data to disk and start a new line.
       
       
-      LIB_EXPORT void Flush();
+      LIB_EXPORT void Flush(); // In asynchronous mode, hands off buffered data to the writer without waiting
       
       
     private:
       LIB_EXPORT static FilePtr createWithPath(World* world, Apto::String path, bool append, Feedback* feedback);
 
       LIB_LOCAL File(World* world, const OutputID& output_id, bool append = false);
+      
+      LIB_LOCAL void submitBuffer();
+      LIB_LOCAL void stopAsync();
     };
     
 
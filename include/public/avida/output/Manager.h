@@ -44,6 +44,8 @@ namespace Avida {
       
       Apto::String m_output_path;
       
+      AsyncWriterPtr m_async_writer;  // must outlive the sockets, which drain into it on destruction
+      
       mutable Apto::Mutex m_mutex;
       Apto::Map<OutputID, SocketWeakRef> m_sockets;
       Apto::Map<OutputID, SocketPtr> m_static_sockets;
@@ -59,7 +61,12 @@ namespace Avida {
       LIB_EXPORT bool IsOpen(const OutputID& output_id) const;
       LIB_EXPORT bool Close(const OutputID& output_id);
       
-      LIB_EXPORT void FlushAll();
+      LIB_EXPORT void FlushAll(); // Writes all buffered output, waiting for asynchronous writes to reach disk
+      
+      // Files opened after this call format rows into memory and write them from a background thread.  Submitting
+      // blocks only when more than max_queued_bytes are waiting to be written.
+      LIB_EXPORT bool EnableAsyncOutput(int max_queued_bytes);
+      LIB_EXPORT AsyncWriterPtr AsyncOutputWriter() const;
       
       LIB_EXPORT bool AttachTo(World* world);
       LIB_EXPORT static ManagerPtr Of(World* world);
@@ -70,6 +77,7 @@ namespace Avida {
     public:
       LIB_LOCAL WorldFacetID UpdateBefore() const;
       LIB_LOCAL WorldFacetID UpdateAfter() const;
+      LIB_LOCAL void PerformUpdate(Context& ctx, Update current_update);
       
     private:
       LIB_EXPORT bool RegisterSocket(const OutputID& output_id, SocketWeakRef socket_ref);
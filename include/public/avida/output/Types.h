@@ -33,6 +33,7 @@ namespace Avida {
     // Class Declarations
     // --------------------------------------------------------------------------------------------------------------
     
+    class AsyncWriter;
     class File;
     class Manager;
     class Socket;
@@ -43,6 +44,7 @@ namespace Avida {
     
     typedef Apto::String OutputID;
     typedef Socket* SocketWeakRef;
+    typedef Apto::SmartPtr<AsyncWriter, Apto::InternalRCObject> AsyncWriterPtr;
     typedef Apto::SmartPtr<File, Apto::InternalRCObject> FilePtr;
     typedef Apto::SmartPtr<Manager, Apto::InternalRCObject> ManagerPtr;
     typedef Apto::SmartPtr<Socket, Apto::InternalRCObject> SocketPtr;
@@ -69,6 +69,9 @@ namespace Avida {
     
     // MapMode Base Class Definition
     // --------------------------------------------------------------------------------------------------------------  
+    //
+    //  Map modes are double buffered.  Update() and SetProperty() compute new values into a back buffer while the
+    //  values returned by the accessors and GetProperty() remain those published by the last SwapBuffers().
     
     class MapMode
     {
@@ -88,11 +91,21 @@ namespace Avida {
       virtual Apto::String GetProperty(const Apto::String& property) const = 0;
       
       virtual void Update(cPopulation& pop) = 0;
+      virtual void SwapBuffers() = 0;
     };
     
     
     // Map Definition
     // --------------------------------------------------------------------------------------------------------------  
+    //
+    //  Only the modes currently selected for color, symbols and tags are computed by UpdateMaps().  A newly selected
+    //  mode is computed by SetMode() right away if the population is idle (the driver is paused, including before the
+    //  first update), and otherwise at the next map update.  Modes are computed outside of the read/write lock, which
+    //  is only write locked to publish the new buffers, so viewers holding the map (Retain/Release) never wait on the
+    //  computation itself.
+    //
+    //  SetMode() and SetModeProperty() publish under the write lock, so they must not be called between Retain() and
+    //  Release().  GetModeProperty() may be.
     
     class Map
     {
@@ -106,7 +119,12 @@ namespace Avida {
       int m_symbol_mode;     // Current map symbol mode (index into m_view_modes, -1 = off)
       int m_tag_mode;        // Current map tag mode (index into m_view_modes, -1 = off)
       
-      Apto::RWLock m_rw_lock;
+      cPopulation* m_population;   // Population the modes are computed from
+      bool m_population_idle;      // Is the population safe to compute modes from outside of UpdateMaps()?
+      Apto::Array<bool> m_mode_current;  // Does each mode reflect the last map update?
+      
+      mutable Apto::Mutex m_update_mutex;  // Serializes computation of the view modes and changes to mode selection
+      Apto::RWLock m_rw_lock;      // Read locked by viewers, write locked only to publish computed buffers and modes
       
       
     public:
@@ -143,7 +161,7 @@ namespace Avida {
       inline const Apto::String& GetModeName(int idx) const { return m_view_modes[idx]->GetName(); }
       inline int GetModeSupportedTypes(int idx) const { return m_view_modes[idx]->GetSupportedTypes(); }
       bool SetModeProperty(int idx, const Apto::String& property, const Apto::String& value);
-      inline Apto::String GetModeProperty(int idx, const Apto::String& property) const { return m_view_modes[idx]->GetProperty(property); }
+      Apto::String GetModeProperty(int idx, const Apto::String& property) const;
       
       void SetMode(int mode);
       inline void SetNumViewerColors(int num_colors) { m_num_viewer_colors = num_colors; }
@@ -155,10 +173,12 @@ namespace Avida {
       
       // Core Viewer Internal Methods
       void UpdateMaps(cPopulation& pop);
+      void SetPopulationIdle(bool idle);
       
       
     protected:
-      void updateMap(cPopulation& pop, int map_id);
+      void activeModes(Apto::Array<int, Apto::Smart>& modes) const;
+      void computeStaleModes(const Apto::Array<int, Apto::Smart>& modes);
     };
     
   };
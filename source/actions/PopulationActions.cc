@@ -3842,6 +3842,7 @@ public:
       ctx.Driver().Feedback().Warning(err);
       return;
     }
+    m_world->GetPopulation().CellConnectionsChanged();
     
     // Loop through all of the rows and make the cut on each...
     for (int row_id = m_min; row_id < m_max; row_id++) {
@@ -3920,6 +3921,7 @@ public:
       ctx.Driver().Feedback().Warning(err);
       return;
     }
+    m_world->GetPopulation().CellConnectionsChanged();
     
     // Loop through all of the cols and make the cut on each...
     for (int col_id = m_min; col_id < m_max; col_id++) {
@@ -3996,6 +3998,7 @@ public:
       ctx.Driver().Feedback().Warning(err);
       return;
     }
+    m_world->GetPopulation().CellConnectionsChanged();
     // Loop through all of the rows and make the cut on each...
     for (int row_id = m_min; row_id < m_max; row_id++) {
       //compute which cells to be joined -- grab them from the population
@@ -4072,6 +4075,7 @@ public:
       ctx.Driver().Feedback().Warning(err);
       return;
     }
+    m_world->GetPopulation().CellConnectionsChanged();
     // Loop through all of the rows and make the cut on each...
     for (int col_id = m_min; col_id < m_max; col_id++) {
       //compute which cells are beoing joined and grab them
@@ -4136,6 +4140,7 @@ public:
       ctx.Driver().Feedback().Warning("ConnectCells cell out of range");
       return;
     }
+    m_world->GetPopulation().CellConnectionsChanged();
     int idA = m_a_y * world_x + m_a_x;
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
@@ -4176,6 +4181,7 @@ public:
       ctx.Driver().Feedback().Warning("DisconnectCells cell out of range");
       return;
     }
+    m_world->GetPopulation().CellConnectionsChanged();
     int idA = m_a_y * world_x + m_a_x;
     int idB = m_b_y * world_x + m_b_x;
     cPopulationCell& cellA = m_world->GetPopulation().GetCell(idA);
@@ -24,10 +24,12 @@
 #include "avida/core/Feedback.h"
 #include "avida/core/InstructionSequence.h"
 #include "avida/core/WorldDriver.h"
+#include "avida/data/ColumnarRecorder.h"
 #include "avida/data/Manager.h"
 #include "avida/data/Package.h"
 #include "avida/data/Recorder.h"
 #include "avida/output/File.h"
+#include "avida/output/Manager.h"
 #include "avida/systematics/Arbiter.h"
 #include "avida/systematics/Group.h"
 #include "avida/systematics/Manager.h"
@@ -53,6 +55,7 @@
 #include "cPlasticPhenotype.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
+#include "cProfiler.h"
 #include "cStats.h"
 #include "cWorld.h"
 #include "cUserFeedback.h"
@@ -412,6 +415,126 @@ public:
   }
 };
 
+class cActionPrintProfile : public cAction
+{
+private:
+  cString m_inst_filename;
+  cString m_update_filename;
+  
+public:
+  cActionPrintProfile(cWorld* world, const cString& args, Feedback&)
+  : cAction(world, args), m_inst_filename("profile.dat"), m_update_filename("profile_update.dat")
+  {
+    cString largs(args);
+    largs.Trim();
+    if (largs.GetSize()) m_inst_filename = largs.PopWord();
+    if (largs.GetSize()) m_update_filename = largs.PopWord();
+  }
+  
+  static const cString GetDescription() { return "Arguments: [string inst_fname=\"profile.dat\"] [string update_fname=\"profile_update.dat\"]"; }
+  
+  void Process(cAvidaContext&)
+  {
+    cProfiler& profiler = m_world->GetProfiler();
+    if (!profiler.IsEnabled()) return;
+    
+    const int update = m_world->GetStats().GetUpdate();
+    cHardwareManager& hwm = m_world->GetHardwareManager();
+    
+    Avida::Output::FilePtr df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)m_inst_filename);
+    df->WriteComment("Avida instruction execution profile");
+    df->WriteComment("Execution counts are cumulative, cycles are averaged over the sampled executions");
+    df->WriteTimeStamp();
+    
+    for (int is = 0; is < hwm.GetNumInstSets(); is++) {
+      const cInstSet& inst_set = hwm.GetInstSet(is);
+      const cInstProfile& profile = *profiler.GetInstProfile(is);
+      for (int i = 0; i < profile.GetSize(); i++) {
+        df->Write(update, "Update");
+        df->Write(inst_set.GetHardwareType(), "Hardware Type");
+        df->Write(inst_set.GetInstSetName(), "Instruction Set");
+        df->Write(inst_set.GetName(i), "Instruction");
+        df->Write((double)profile.GetExecCount(i), "Executions");
+        df->Write((double)profile.GetSampleCount(i), "Timing Samples");
+        df->Write(profile.GetAveSampleCycles(i), "Average Sampled Cycles");
+        df->Endl();
+      }
+    }
+    
+    df = Avida::Output::File::StaticWithPath(m_world->GetNewWorld(), (const char*)m_update_filename);
+    df->WriteComment("Avida per-update execution profile");
+    df->WriteComment("Births are timed within execution, speculative counts are cumulative");
+    df->WriteTimeStamp();
+    
+    df->Write(update, "Update");
+    for (int i = 0; i < cProfiler::NUM_PHASES; i++) {
+      cProfiler::ePhase phase = (cProfiler::ePhase)i;
+      df->Write((double)profiler.GetLastPhaseCycles(phase), cStringUtil::Stringf("Last Update Cycles (%s)", cProfiler::GetPhaseName(phase)));
+      df->Write((double)profiler.GetTotalPhaseCycles(phase), cStringUtil::Stringf("Total Cycles (%s)", cProfiler::GetPhaseName(phase)));
+    }
+    df->Write((double)profiler.GetSpeculativeExecuted(), "Speculative Instructions Executed");
+    df->Write((double)profiler.GetSpeculativeRollbacks(), "Speculative Rollbacks");
+    df->Write((double)profiler.GetSpeculativeWasted(), "Speculative Instructions Wasted");
+    df->Endl();
+  }
+};
+
+
+class cActionRecordColumnarData : public cAction
+{
+private:
+  cString m_filename;
+  Apto::Array<Data::DataID> m_data_ids;
+  int m_interval;
+  int m_block_rows;
+  bool m_compress;
+  Apto::SmartPtr<Data::ColumnarRecorder, Apto::InternalRCObject> m_recorder;
+  
+public:
+  cActionRecordColumnarData(cWorld* world, const cString& args, Feedback& feedback)
+  : cAction(world, args), m_filename("data.adc"), m_interval(1), m_block_rows(256), m_compress(false)
+  {
+    cString largs(args);
+    largs.Trim();
+    if (largs.GetSize()) m_filename = largs.PopWord();
+    if (largs.GetSize()) {
+      cString ids = largs.PopWord();
+      while (ids.GetSize()) m_data_ids.Push((const char*)ids.Pop(','));
+    }
+    if (largs.GetSize()) m_interval = largs.PopWord().AsInt();
+    if (largs.GetSize()) m_block_rows = largs.PopWord().AsInt();
+    if (largs.GetSize()) m_compress = largs.PopWord().AsInt();
+    
+    if (m_data_ids.GetSize() == 0) feedback.Error("RecordColumnarData requires at least one data id");
+    if (m_compress && !Data::ColumnarRecorder::CompressionAvailable()) {
+      feedback.Warning("compression support not available, '%s' will be written uncompressed", (const char*)m_filename);
+    }
+  }
+  
+  static const cString GetDescription() { return "Arguments: <string fname> <string data_ids> [int interval=1] [int block_rows=256] [int compress=0]"; }
+  
+  void Process(cAvidaContext&)
+  {
+    // Recording starts the first time the action fires, subsequent triggers write out accumulated rows
+    if (m_recorder) {
+      m_recorder->Flush();
+      return;
+    }
+    if (m_data_ids.GetSize() == 0) return;
+    
+    Apto::String path = Avida::Output::Manager::Of(m_world->GetNewWorld())->OutputIDFromPath((const char*)m_filename);
+    m_recorder = Apto::SmartPtr<Data::ColumnarRecorder, Apto::InternalRCObject>(
+      new Data::ColumnarRecorder(path, m_data_ids, m_interval, m_block_rows, m_compress));
+    
+    if (!m_recorder->Good()) {
+      m_world->GetDriver().Feedback().Error("unable to open '%s' for writing", (const char*)path);
+    } else if (!m_world->GetDataManager()->AttachRecorder(m_recorder)) {
+      m_world->GetDriver().Feedback().Error("RecordColumnarData: unable to record requested data in '%s'", (const char*)m_filename);
+    }
+  }
+};
+
+
 class cActionPrintPreyInstructionData : public cAction
 {
 private:
@@ -2283,12 +2406,17 @@ public:
       Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)this_path);
       ofstream& fot = df->OFStream();
       PrintHeader(fot);
+      Apto::Array<cAnalyzeGenotype*> genotypes;
+      Apto::Array<Genome> genomes;
       tListIterator<cAnalyzeGenotype> batch_it(m_world->GetAnalyze().GetCurrentBatch().List());
       cAnalyzeGenotype* genotype = NULL;
       while((genotype = batch_it.Next())){
-        Apto::SmartPtr<cPhenPlastGenotype> ppgen(new cPhenPlastGenotype(genotype->GetGenome(), m_num_trials, test_info, m_world, ctx));
-        PrintPPG(fot, ppgen, genotype->GetID(), genotype->GetParents());
+        genotypes.Push(genotype);
+        genomes.Push(genotype->GetGenome());
       }
+      Apto::Array<Apto::SmartPtr<cPhenPlastGenotype> > ppgens;
+      cPhenPlastGenotype::TestGenomes(genomes, m_num_trials, test_info, m_world, ctx, ppgens);
+      for (int i = 0; i < genotypes.GetSize(); i++) PrintPPG(fot, ppgens[i], genotypes[i]->GetID(), genotypes[i]->GetParents());
     } else{  // Run mode
       cString this_path = m_filename + "-" + cStringUtil::Convert(m_world->GetStats().GetUpdate()) + ".dat";
       Avida::Output::FilePtr df = Avida::Output::File::CreateWithPath(m_world->GetNewWorld(), (const char*)m_filename);
@@ -2297,10 +2425,16 @@ public:
       
       Systematics::ManagerPtr classmgr = Systematics::Manager::Of(m_world->GetNewWorld());
       Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
+      Apto::Array<Systematics::GroupPtr> groups;
+      Apto::Array<Genome> genomes;
       while (it->Next()) {
-        Systematics::GroupPtr bg = it->Get();
-        Apto::SmartPtr<cPhenPlastGenotype> ppgen(new cPhenPlastGenotype(Genome(bg->Properties().Get("genome")), m_num_trials, test_info, m_world, ctx));
-        PrintPPG(fot, ppgen, bg->ID(), (const char*)bg->Properties().Get("parents").StringValue());
+        groups.Push(it->Get());
+        genomes.Push(Genome(it->Get()->Properties().Get("genome")));
+      }
+      Apto::Array<Apto::SmartPtr<cPhenPlastGenotype> > ppgens;
+      cPhenPlastGenotype::TestGenomes(genomes, m_num_trials, test_info, m_world, ctx, ppgens);
+      for (int i = 0; i < groups.GetSize(); i++) {
+        PrintPPG(fot, ppgens[i], groups[i]->ID(), (const char*)groups[i]->Properties().Get("parents").StringValue());
       }
     }
   }
@@ -2377,6 +2511,7 @@ public:
       }
     }
     else {  // E X P E R I M E N T    M O D E  (See above for explination)
+      cPhenPlastUtil::TestPopulation(ctx, m_world);
       Systematics::ManagerPtr classmgr = Systematics::Manager::Of(m_world->GetNewWorld());
       Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
       while (it->Next()) {
@@ -2496,6 +2631,7 @@ public:
       } // End looping through genotypes
     }
     else {  // E X P E R I M E N T    M O D E    (See above for explination)
+      cPhenPlastUtil::TestPopulation(ctx, m_world);
       Systematics::ManagerPtr classmgr = Systematics::Manager::Of(m_world->GetNewWorld());
       Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
       pp_entropy.ResizeClear(num_genotypes);
@@ -5102,6 +5238,8 @@ void RegisterPrintActions(cActionLibrary* action_lib)
   action_lib->Register<cActionPrintSenseData>("PrintSenseData");
   action_lib->Register<cActionPrintSenseExeData>("PrintSenseExeData");
   action_lib->Register<cActionPrintInstructionData>("PrintInstructionData");
+  action_lib->Register<cActionPrintProfile>("PrintProfile");
+  action_lib->Register<cActionRecordColumnarData>("RecordColumnarData");
   action_lib->Register<cActionPrintInternalTasksData>("PrintInternalTasksData");
   action_lib->Register<cActionPrintInternalTasksQualData>("PrintInternalTasksQualData");
   action_lib->Register<cActionPrintSleepData>("PrintSleepData");
@@ -21,6 +21,8 @@
 
 #include "SaveLoadActions.h"
 
+#include "avida/output/Manager.h"
+
 #include "cAction.h"
 #include "cActionLibrary.h"
 #include "cArgContainer.h"
@@ -127,6 +129,9 @@ public:
   {
     int update = m_world->GetStats().GetUpdate();
     cString filename = cStringUtil::Stringf("%s-%d.spop", (const char*)m_filename, update);
+    
+    // Checkpoint - bring data files up to date with the saved population
+    Avida::Output::Manager::Of(m_world->GetNewWorld())->FlushAll();
     m_world->GetPopulation().SavePopulation(filename, m_save_historic, m_save_group_info, m_save_avatars, m_save_rebirth);
   }
 };
@@ -64,6 +64,7 @@
 #include "cResourceHistory.h"
 #include "cStringIterator.h"
 #include "cTestCPU.h"
+#include "cTestCPUBatch.h"
 #include "cUserFeedback.h"
 #include "cWorld.h"
 #include "tAnalyzeJob.h"
@@ -89,6 +90,11 @@ using namespace std;
 using namespace Avida;
 using namespace AvidaTools;
 
+
+// Number of test CPU runs that BatchUtil_Recalculate keeps in flight (and in memory) at once
+static const int RECALCULATE_BLOCK_TESTS = 1024;
+
+
 cAnalyze::cAnalyze(cWorld* world)
 : cur_batch(0)
 /*
@@ -105,11 +111,14 @@ cAnalyze::cAnalyze(cWorld* world)
 , exit_on_error(true)
 , m_world(world)
 , m_ctx(world->GetDefaultContext())
-, m_jobqueue(world)
+, m_jobqueue(world->GetJobQueue())
 , m_resources(NULL)
 , m_resource_time_spent_offset(0)
 , interactive_depth(0)
 {
+  // The job queue belongs to the world.  Analysis seeds its jobs from the world RNG, at the point where the queue
+  // used to be constructed along with cAnalyze.
+  m_jobqueue.ResetJobSeeds(m_world->GetRandom().GetInt(m_world->GetRandom().MaxSeed()));
   random.ResetSeed(m_world->GetConfig().RANDOM_SEED.Get());
   
   for (int i = 0; i < GetNumBatches(); i++) {
@@ -8847,21 +8856,7 @@ void cAnalyze::BatchRecalculate(cString cur_string)
     cerr << "warning: " << msg << endl;
   }
   
-  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * genotype = NULL;
-  cAnalyzeGenotype * last_genotype = NULL;
-  while ((genotype = batch_it.Next()) != NULL) {    
-    // If the previous genotype was the parent of this one, pass in a pointer
-    // to it for improved recalculate (such as distance to parent, etc.)
-    if (last_genotype != NULL && genotype->GetParentID() == last_genotype->GetID()) {
-      genotype->Recalculate(m_ctx, &test_info, last_genotype);
-    } else {
-      genotype->Recalculate(m_ctx, &test_info);
-    }
-    last_genotype = genotype;
-  }
-    
-  return;
+  BatchUtil_Recalculate(test_info, 1);
 }
 
 
@@ -8940,21 +8935,7 @@ void cAnalyze::BatchRecalculateWithArgs(cString cur_string)
     cerr << "warning: " << msg << endl;
   }
   
-  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
-  cAnalyzeGenotype * genotype = NULL;
-  cAnalyzeGenotype * last_genotype = NULL;
-  while ((genotype = batch_it.Next()) != NULL) {    
-    // If the previous genotype was the parent of this one, pass in a pointer
-    // to it for improved recalculate (such as distance to parent, etc.)
-    if (last_genotype != NULL && genotype->GetParentID() == last_genotype->GetID()) {
-      genotype->Recalculate(m_ctx, &test_info, last_genotype, num_trials);
-    } else {
-      genotype->Recalculate(m_ctx, &test_info, NULL, num_trials);
-    }
-    last_genotype = genotype;
-  }
-  
-  return;
+  BatchUtil_Recalculate(test_info, num_trials);
 }
 
 
@@ -9331,6 +9312,40 @@ int cAnalyze::BatchUtil_GetMaxLength(int batch_id)
 }
 
 
+// Recalculates every genotype in the current batch.  Blocks of genotypes are run through the test CPUs together
+// across the analyze job queue, and are then updated in batch order, so each genotype can be passed the one before
+// it as its parent (for distance to parent, etc.) whenever that is the case.
+void cAnalyze::BatchUtil_Recalculate(cCPUTestInfo& test_info, int num_trials)
+{
+  if (num_trials < 1) num_trials = 1;
+  if (num_trials > 1) test_info.UseRandomInputs(true);
+  
+  const int block_size = Apto::Max(1, RECALCULATE_BLOCK_TESTS / num_trials);
+  cTestCPUBatch test_batch(m_world, test_info);
+  Apto::Array<cAnalyzeGenotype*> block;
+  
+  tListIterator<cAnalyzeGenotype> batch_it(batch[cur_batch].List());
+  cAnalyzeGenotype * genotype = batch_it.Next();
+  cAnalyzeGenotype * last_genotype = NULL;
+  while (genotype != NULL) {
+    block.Resize(0);
+    test_batch.Clear();
+    for (; genotype != NULL && block.GetSize() < block_size; genotype = batch_it.Next()) {
+      block.Push(genotype);
+      cPhenPlastGenotype::QueueTrials(test_batch, genotype->GetGenome(), num_trials, m_ctx);
+    }
+    test_batch.Run(m_ctx);
+    
+    for (int i = 0; i < block.GetSize(); i++) {
+      cAnalyzeGenotype* parent = NULL;
+      if (last_genotype != NULL && block[i]->GetParentID() == last_genotype->GetID()) parent = last_genotype;
+      block[i]->LoadRecalculation(cPhenPlastGenotype(block[i]->GetGenome(), num_trials, test_batch, i * num_trials, m_world), parent);
+      last_genotype = block[i];
+    }
+  }
+}
+
+
 void cAnalyze::CommandForeach(cString cur_string,
                               tList<cAnalyzeCommand> & clist)
 {
@@ -88,7 +88,7 @@ private:
 
   cWorld* m_world;
   cAvidaContext& m_ctx;
-  cAnalyzeJobQueue m_jobqueue;
+  cAnalyzeJobQueue& m_jobqueue;
 
   // This is the storage for the resource information from resource.dat.
   cResourceHistory* m_resources;
@@ -181,6 +181,7 @@ private:
   
   // Batch management...
   int BatchUtil_GetMaxLength(int batch_id = -1);
+  void BatchUtil_Recalculate(cCPUTestInfo& test_info, int num_trials);
   
   // Command helpers...
   void CommandDetail_Header(std::ostream& fp, int format_type,
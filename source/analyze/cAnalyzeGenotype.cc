@@ -34,6 +34,7 @@
 #include "cPhenPlastGenotype.h"
 #include "cPlasticPhenotype.h"
 #include "cTestCPU.h"
+#include "cTestCPUBatch.h"
 #include "cEnvironment.h"
 #include "cHardwareManager.h"
 #include "cWorld.h"
@@ -381,8 +382,6 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   
   cAvidaContext& ctx = m_world->GetDefaultContext();
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-  
   // Calculate the base fitness for the genotype we're working with...
   // (This may not have been run already, and cost negligiably more time
   // considering the number of knockouts we need to do.
@@ -394,11 +393,14 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   // If the base fitness is 0, the organism is dead and has no complexity.
   if (base_fitness == 0.0) {
     knockout_stats->neut_count = length;
-    delete testcpu;
     return;
   }
   
   Genome mod_genome(m_genome);
+  InstructionSequencePtr mod_seq_p;
+  GeneticRepresentationPtr mod_rep_p = mod_genome.Representation();
+  mod_seq_p.DynamicCastFrom(mod_rep_p);
+  InstructionSequence& mod_seq = *mod_seq_p;
   
   // Setup a NULL instruction needed for testing
   const Instruction null_inst = m_world->GetHardwareManager().GetInstSet(mod_genome.Properties().Get("instset").StringValue()).ActivateNullInst();
@@ -410,19 +412,26 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
     knockout_stats->has_chart_info = true;
   }
   
-  // Loop through all the lines of code, testing the removal of each.
-  // -2=lethal, -1=detrimental, 0=neutral, 1=beneficial
-  Apto::Array<int> ko_effect(length);
+  // Test the removal of each line of code, all in a single batch.
+  cCPUTestInfo test_info;
+  cTestCPUBatch batch(m_world, test_info);
   for (int line_num = 0; line_num < length; line_num++) {
     // Save a copy of the current instruction and replace it with "NULL"
-    InstructionSequencePtr mod_seq_p;
-    GeneticRepresentationPtr mod_rep_p = mod_genome.Representation();
-    mod_seq_p.DynamicCastFrom(mod_rep_p);
-    InstructionSequence& mod_seq = *mod_seq_p;
     int cur_inst = mod_seq[line_num].GetOp();
     mod_seq[line_num] = null_inst;
-    cAnalyzeGenotype ko_genotype(m_world, mod_genome);
-    ko_genotype.Recalculate(ctx);
+    batch.AddGenome(mod_genome);
+    
+    // Reset the mod_genome back to the original sequence.
+    mod_seq[line_num].SetOp(cur_inst);
+  }
+  batch.Run(ctx);
+  
+  // Loop through all the lines of code, classifying the removal of each.
+  // -2=lethal, -1=detrimental, 0=neutral, 1=beneficial
+  Apto::Array<int> ko_effect(length);
+  for (int line_num = 0; line_num < length; line_num++) {
+    cAnalyzeGenotype ko_genotype(m_world, batch.GetGenome(line_num));
+    ko_genotype.LoadRecalculation(cPhenPlastGenotype(batch.GetGenome(line_num), 1, batch, line_num, m_world));
     if (check_chart == true) {
       const Apto::Array<int> ko_task_counts( ko_genotype.GetTaskCounts() );
       knockout_stats->task_counts[line_num] = ko_task_counts;
@@ -444,73 +453,82 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
     } else {
       cerr << "error: internal: illegal state in CalcKnockouts()" << endl;
     }
-    
-    // Reset the mod_genome back to the original sequence.
-    mod_seq[line_num].SetOp(cur_inst);
   }
   
   // Only continue from here if we are looking at all pairs of knockouts
   // as well.
-  if (check_pairs == false) {
-    delete testcpu;
-    return;
-  }
+  if (check_pairs == false) return;
   
   Apto::Array<int> ko_pair_effect(ko_effect);
+  Apto::Array<int> pair_line2;
   for (int line1 = 0; line1 < length; line1++) {
     // If this line has already been changed, keep going...
     if (ko_effect[line1] != ko_pair_effect[line1]) continue;
     
-    // Loop through all possibilities for the next line.
-    for (int line2 = line1+1; line2 < length; line2++) {
-      // If this line has already been changed, keep going...
-      if (ko_effect[line2] != ko_pair_effect[line2]) continue;
-      
-      // If the two lines are of different types (one is information and the
-      // other is not) then we're not interested in testing this combination
-      // since any possible result is reasonable.
-      if ((ko_effect[line1] < 0 && ko_effect[line2] >= 0) ||
-          (ko_effect[line1] >= 0 && ko_effect[line2] < 0)) {
-        continue;
-      }
+    // Parallel batches test all of the pairs with this line at once.  Pairs are skipped below exactly as if they had
+    // been tested one at a time, so a pair may be tested whose result is never used.  Serial batches share the random
+    // stream, so they test one pair at a time and never run a test that would have been skipped.
+    const int pairs_per_batch = (batch.IsParallel()) ? length : 1;
+    int next_line2 = line1 + 1;
+    while (next_line2 < length) {
+      batch.Clear();
+      pair_line2.Resize(0);
+      for (; next_line2 < length && pair_line2.GetSize() < pairs_per_batch; next_line2++) {
+        const int line2 = next_line2;
       
-      // Calculate the fitness for this pair of knockouts to determine if its
-      // something other than what we expected.
-      InstructionSequencePtr mod_seq_p;
-      GeneticRepresentationPtr mod_rep_p = mod_genome.Representation();
-      mod_seq_p.DynamicCastFrom(mod_rep_p);
-      InstructionSequence& mod_genome_seq = *mod_seq_p;
+        // If this line has already been changed, keep going...
+        if (ko_effect[line2] != ko_pair_effect[line2]) continue;
       
-      int cur_inst1 = mod_genome_seq[line1].GetOp();
-      int cur_inst2 = mod_genome_seq[line2].GetOp();
-      mod_genome_seq[line1] = null_inst;
-      mod_genome_seq[line2] = null_inst;
-      cAnalyzeGenotype ko_genotype(m_world, mod_genome);
-      ko_genotype.Recalculate(ctx);
+        // If the two lines are of different types (one is information and the
+        // other is not) then we're not interested in testing this combination
+        // since any possible result is reasonable.
+        if ((ko_effect[line1] < 0 && ko_effect[line2] >= 0) ||
+            (ko_effect[line1] >= 0 && ko_effect[line2] < 0)) {
+          continue;
+        }
       
-      double ko_fitness = ko_genotype.GetFitness();
+        int cur_inst1 = mod_seq[line1].GetOp();
+        int cur_inst2 = mod_seq[line2].GetOp();
+        mod_seq[line1] = null_inst;
+        mod_seq[line2] = null_inst;
+        batch.AddGenome(mod_genome);
+        pair_line2.Push(line2);
       
-      // If the individual knockouts are both harmful, but in combination
-      // they are neutral or even beneficial, they should not count as 
-      // information.
-      if (ko_fitness >= base_fitness &&
-          ko_effect[line1] < 0 && ko_effect[line2] < 0) {
-        ko_pair_effect[line1] = 0;
-        ko_pair_effect[line2] = 0;
+        // Reset the mod_genome back to the original sequence.
+        mod_seq[line1].SetOp(cur_inst1);
+        mod_seq[line2].SetOp(cur_inst2);
       }
+      batch.Run(ctx);
+    
+      for (int pair = 0; pair < pair_line2.GetSize(); pair++) {
+        const int line2 = pair_line2[pair];
+        if (ko_effect[line2] != ko_pair_effect[line2]) continue;
       
-      // If the individual knockouts are both neutral (or beneficial?),
-      // but in combination they are harmful, they are likely redundant
-      // to each other.  For now, count them both as information.
-      if (ko_fitness < base_fitness &&
-          ko_effect[line1] >= 0 && ko_effect[line2] >= 0) {
-        ko_pair_effect[line1] = -1;
-        ko_pair_effect[line2] = -1;
-      }	
+        // Calculate the fitness for this pair of knockouts to determine if its
+        // something other than what we expected.
+        cAnalyzeGenotype ko_genotype(m_world, batch.GetGenome(pair));
+        ko_genotype.LoadRecalculation(cPhenPlastGenotype(batch.GetGenome(pair), 1, batch, pair, m_world));
       
-      // Reset the mod_genome back to the original sequence.
-      mod_genome_seq[line1].SetOp(cur_inst1);
-      mod_genome_seq[line2].SetOp(cur_inst2);
+        double ko_fitness = ko_genotype.GetFitness();
+      
+        // If the individual knockouts are both harmful, but in combination
+        // they are neutral or even beneficial, they should not count as 
+        // information.
+        if (ko_fitness >= base_fitness &&
+            ko_effect[line1] < 0 && ko_effect[line2] < 0) {
+          ko_pair_effect[line1] = 0;
+          ko_pair_effect[line2] = 0;
+        }
+      
+        // If the individual knockouts are both neutral (or beneficial?),
+        // but in combination they are harmful, they are likely redundant
+        // to each other.  For now, count them both as information.
+        if (ko_fitness < base_fitness &&
+            ko_effect[line1] >= 0 && ko_effect[line2] >= 0) {
+          ko_pair_effect[line1] = -1;
+          ko_pair_effect[line2] = -1;
+        }	
+      }
     }
   }
   
@@ -522,7 +540,6 @@ void cAnalyzeGenotype::CalcKnockouts(bool check_pairs, bool check_chart) const
   }
   
   knockout_stats->has_pair_info = true;
-  delete testcpu;
 }
 
 void cAnalyzeGenotype::CheckLand() const
@@ -568,7 +585,14 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
   
   // Handling recalculation here
   cPhenPlastGenotype recalc_data(m_genome, num_trials, *test_info, m_world, ctx);
+  LoadRecalculation(recalc_data, parent_genotype);
   
+  delete local_test_info;
+}
+
+
+void cAnalyzeGenotype::LoadRecalculation(const cPhenPlastGenotype& recalc_data, cAnalyzeGenotype* parent_genotype)
+{
   // The most likely phenotype will be assigned to the phenotype stats
   const cPlasticPhenotype* likely_phenotype = recalc_data.GetMostLikelyPhenotype();
   
@@ -620,13 +644,11 @@ void cAnalyzeGenotype::Recalculate(cAvidaContext& ctx, cCPUTestInfo* test_info,
   }
   
   // Summarize plasticity information if multiple recalculations performed
-  if (num_trials > 1){
+  if (recalc_data.GetNumTrials() > 1){
     if (m_phenplast_stats != NULL)
       delete m_phenplast_stats;
     m_phenplast_stats = new cPhenPlastSummary(recalc_data);
   }
-  
-  delete local_test_info;
 }
 
 
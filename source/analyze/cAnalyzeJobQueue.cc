@@ -27,6 +27,7 @@
 #include "avida/core/WorldDriver.h"
 
 #include "cAnalyzeJobWorker.h"
+#include "cAvidaContext.h"
 #include "cWorld.h"
 
 
@@ -38,16 +39,19 @@ using namespace Avida;
 
 
 cAnalyzeJobQueue::cAnalyzeJobQueue(cWorld* world)
-: m_world(world), m_last_jobid(0), m_jobs(0), m_pending(0), m_workers(Apto::Platform::AvailableCPUs())
+: m_world(world), m_last_jobid(0), m_generation(0), m_outstanding(0), m_next_deque(0), m_terminate(false)
+, m_workers(Apto::Platform::AvailableCPUs())
 {
   const int max_workers = world->GetConfig().MAX_CONCURRENCY.Get();
   if (max_workers > 0 && max_workers < m_workers.GetSize()) m_workers.Resize(max_workers);
   
-  m_job_seed_rng = new Apto::RNG::AvidaRNG(world->GetRandom().GetInt(world->GetRandom().MaxSeed()));
+  // Seeded from the configuration, rather than the world RNG, until ResetJobSeeds() is called
+  m_job_seed_rng = new Apto::RNG::AvidaRNG(world->GetConfig().RANDOM_SEED.Get());
   
   if (m_workers.GetSize() > 1) {
+    m_deques.Resize(m_workers.GetSize());
     for (int i = 0; i < m_workers.GetSize(); i++) {
-      m_workers[i] = new cAnalyzeJobWorker(this);
+      m_workers[i] = new cAnalyzeJobWorker(this, i);
       m_workers[i]->Start();
     }
   } else {
@@ -59,15 +63,16 @@ cAnalyzeJobQueue::~cAnalyzeJobQueue()
 {
   const int num_workers = m_workers.GetSize();
   
-  m_mutex.Lock();
-  
   // Clean out any waiting jobs
-  cAnalyzeJob* job;
-  while ((job = m_queue.Pop())) delete job;
-  
-  // Set job count so that all workers receive NULL jobs
-  m_jobs = num_workers;
+  for (int i = 0; i < m_deques.GetSize(); i++) {
+    Apto::MutexAutoLock lock(m_deques[i].mutex);
+    cAnalyzeJob* job;
+    while ((job = m_deques[i].jobs.Pop())) delete job;
+  }
   
+  // Tell all workers to exit once they run out of work
+  m_mutex.Lock();
+  m_terminate = true;
   m_mutex.Unlock();
   
   // Signal all workers to check job queue
@@ -81,30 +86,71 @@ cAnalyzeJobQueue::~cAnalyzeJobQueue()
   delete m_job_seed_rng;
 }
 
-inline void cAnalyzeJobQueue::queueJob(cAnalyzeJob* job)
+void cAnalyzeJobQueue::ResetJobSeeds(int seed)
 {
-  if (m_workers.GetSize()) m_queue.PushRear(job);
-  else singleThreadedJobExecution(job);
+  Apto::MutexAutoLock lock(m_mutex);
+  m_job_seed_rng->ResetSeed(seed);
 }
 
-void cAnalyzeJobQueue::AddJob(cAnalyzeJob* job)
+// Seeds are handed out with the job IDs, under m_mutex, so the jobs receive the seed stream in ID order no matter which
+// worker runs them.  This is the order in which single threaded execution has always drawn them.
+inline void cAnalyzeJobQueue::assignJob(cAnalyzeJob* job)
 {
-  Apto::MutexAutoLock lock(m_mutex);
   job->SetID(m_last_jobid++);
-  queueJob(job);
-  m_jobs++;
+  job->SetSeed(m_job_seed_rng->GetInt(m_job_seed_rng->MaxSeed()));
 }
 
-void cAnalyzeJobQueue::AddJobImmediate(cAnalyzeJob* job)
+void cAnalyzeJobQueue::queueJobs(cAnalyzeJob* const* jobs, int num_jobs)
 {
+  if (num_jobs == 0) return;
+  
+  if (!m_workers.GetSize()) {
+    for (int i = 0; i < num_jobs; i++) {
+      m_mutex.Lock();
+      assignJob(jobs[i]);
+      m_mutex.Unlock();
+      singleThreadedJobExecution(jobs[i]);
+    }
+    return;
+  }
+  
+  const int num_deques = m_deques.GetSize();
   m_mutex.Lock();
-  job->SetID(m_last_jobid++);
-  queueJob(job);
-  m_jobs++;
-  m_mutex.Unlock(); // should unlock prior to signaling condition variable
+  for (int i = 0; i < num_jobs; i++) assignJob(jobs[i]);
+  const int first_deque = m_next_deque;
+  m_next_deque = (m_next_deque + num_jobs) % num_deques;
+  m_outstanding += num_jobs;
+  m_mutex.Unlock();
+  
+  // Deal the jobs out across the worker deques
+  for (int d = 0; d < num_deques && d < num_jobs; d++) {
+    sWorkerDeque& deque = m_deques[(first_deque + d) % num_deques];
+    Apto::MutexAutoLock lock(deque.mutex);
+    for (int i = d; i < num_jobs; i += num_deques) deque.jobs.PushRear(jobs[i]);
+  }
+  
+  // Only advance the generation once the jobs can be taken, so that idle workers never miss them
+  m_mutex.Lock();
+  m_generation++;
+  m_mutex.Unlock();
+}
+
+void cAnalyzeJobQueue::AddJob(cAnalyzeJob* job)
+{
+  queueJobs(&job, 1);
+}
+
+void cAnalyzeJobQueue::AddJobImmediate(cAnalyzeJob* job)
+{
+  queueJobs(&job, 1);
   m_cond.Signal();
 }
 
+void cAnalyzeJobQueue::AddJobs(const Apto::Array<cAnalyzeJob*>& jobs)
+{
+  if (jobs.GetSize()) queueJobs(&jobs[0], jobs.GetSize());
+}
+
 
 void cAnalyzeJobQueue::Start()
 {
@@ -124,7 +170,7 @@ void cAnalyzeJobQueue::Execute()
   
   // Wait for term signal
   m_mutex.Lock();
-  while (m_jobs > 0 || m_pending > 0) {
+  while (m_outstanding > 0) {
     m_term_cond.Wait(m_mutex);
   }
   m_mutex.Unlock();
@@ -133,11 +179,72 @@ void cAnalyzeJobQueue::Execute()
     m_world->GetDriver().Feedback().Notify("job queue complete");
 }
 
-void cAnalyzeJobQueue::singleThreadedJobExecution(cAnalyzeJob* job)
+
+cAnalyzeJob* cAnalyzeJobQueue::takeJob(int worker_id)
 {
-  Apto::RNG::AvidaRNG rng(GetSeedForJob(job->GetID()));
+  const int num_deques = m_deques.GetSize();
+  cAnalyzeJob* job = NULL;
+  
+  // Most recently queued work from the worker's own deque first...
+  {
+    sWorkerDeque& deque = m_deques[worker_id];
+    Apto::MutexAutoLock lock(deque.mutex);
+    job = deque.jobs.PopRear();
+  }
+  
+  // ...then the oldest work of the other workers
+  for (int i = 1; job == NULL && i < num_deques; i++) {
+    sWorkerDeque& deque = m_deques[(worker_id + i) % num_deques];
+    Apto::MutexAutoLock lock(deque.mutex);
+    job = deque.jobs.Pop();
+  }
+  
+  return job;
+}
+
+
+// Runs the oldest waiting job on the calling thread, returning false if there was none.  Threads waiting on a batch
+// help with the queue this way, so that batches submitted from within running jobs cannot starve the pool.
+bool cAnalyzeJobQueue::RunPendingJob()
+{
+  cAnalyzeJob* job = NULL;
+  for (int i = 0; job == NULL && i < m_deques.GetSize(); i++) {
+    Apto::MutexAutoLock lock(m_deques[i].mutex);
+    job = m_deques[i].jobs.Pop();
+  }
+  if (job == NULL) return false;
+  
+  Apto::RNG::AvidaRNG rng(job->GetSeed());
   cAvidaContext ctx(&m_world->GetDriver(), rng);
+  ctx.SetAnalyzeMode();
   job->Run(ctx);
   delete job;
+  
+  Apto::MutexAutoLock lock(m_mutex);
+  if (--m_outstanding == 0) m_term_cond.Broadcast();
+  return true;
 }
 
+
+// Called by a worker that found no work.  Reports the jobs it has completed since it last idled, then sleeps until
+// jobs are queued after the generation it last saw.  Returns false when the worker should exit.
+bool cAnalyzeJobQueue::waitForJobs(int& generation, int completed)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  
+  m_outstanding -= completed;
+  if (completed && m_outstanding == 0) m_term_cond.Broadcast();
+  
+  while (m_generation == generation && !m_terminate) m_cond.Wait(m_mutex);
+  generation = m_generation;
+  
+  return !m_terminate;
+}
+
+void cAnalyzeJobQueue::singleThreadedJobExecution(cAnalyzeJob* job)
+{
+  Apto::RNG::AvidaRNG rng(job->GetSeed());
+  cAvidaContext ctx(&m_world->GetDriver(), rng);
+  job->Run(ctx);
+  delete job;
+}
@@ -44,22 +44,35 @@ class cAnalyzeJobQueue
   friend class cAnalyzeJobWorker;
   
 private:
+  // Each worker owns a deque of jobs, taking work from its back and stealing from the front of the others
+  struct sWorkerDeque
+  {
+    Apto::Mutex mutex;
+    tList<cAnalyzeJob> jobs;
+  };
+  
   cWorld* m_world;
-  tList<cAnalyzeJob> m_queue;
   int m_last_jobid;
-  Apto::Random* m_job_seed_rng;
+  Apto::Random* m_job_seed_rng;   // job seeds are drawn from this stream in job ID order, as the jobs are queued
   Apto::Mutex m_mutex;
   Apto::ConditionVariable m_cond;
   Apto::ConditionVariable m_term_cond;
   
-  volatile int m_jobs;      // count of waiting jobs, used in condition variable constructs
-  volatile int m_pending;   // count of currently executing jobs
+  int m_generation;         // advanced whenever jobs are queued, used to detect work arriving while a worker idles
+  int m_outstanding;        // count of jobs queued but not yet reported complete
+  int m_next_deque;         // deque that receives the next queued job
+  bool m_terminate;
   
   Apto::Array<cAnalyzeJobWorker*> m_workers;
+  Apto::Array<sWorkerDeque, Apto::ManagedPointer> m_deques;
 
 
   void singleThreadedJobExecution(cAnalyzeJob* job);
-  inline void queueJob(cAnalyzeJob* job);
+  inline void assignJob(cAnalyzeJob* job);
+  void queueJobs(cAnalyzeJob* const* jobs, int num_jobs);
+  
+  cAnalyzeJob* takeJob(int worker_id);
+  bool waitForJobs(int& generation, int completed);
 
   
   cAnalyzeJobQueue(); // @not_implemented
@@ -73,11 +86,16 @@ public:
 
   void AddJob(cAnalyzeJob* job);
   void AddJobImmediate(cAnalyzeJob* job);
+  void AddJobs(const Apto::Array<cAnalyzeJob*>& jobs);
+
+  int GetNumWorkers() const { return m_workers.GetSize(); }
+  
+  // Restarts the stream that the seeds of subsequently queued jobs are drawn from
+  void ResetJobSeeds(int seed);
+  bool RunPendingJob();
 
   void Start();
   void Execute();
-  
-  int GetSeedForJob(int jobid) { Apto::MutexAutoLock lock(m_mutex); return m_job_seed_rng->GetInt(m_job_seed_rng->MaxSeed()); }
 };
 
 #endif
@@ -32,34 +32,22 @@ void cAnalyzeJobWorker::Run()
   cAvidaContext ctx(&m_queue->m_world->GetDriver(), rng);
   ctx.SetAnalyzeMode();
   
-  cAnalyzeJob* job = NULL;
+  int generation = -1;
+  int completed = 0;
   
   while (1) {
-    m_queue->m_mutex.Lock();
-    while (m_queue->m_jobs == 0) {
-      m_queue->m_cond.Wait(m_queue->m_mutex);
-    }
-    job = m_queue->m_queue.Pop();
-    m_queue->m_jobs--;
-    m_queue->m_pending++; 
-    m_queue->m_mutex.Unlock();
+    cAnalyzeJob* job = m_queue->takeJob(m_id);
     
     if (job) {
-      // Set RNG from the waiting pool and execute the job
-      rng.ResetSeed(m_queue->GetSeedForJob(job->GetID()));
+      // Set RNG from the seed assigned with the job and execute the job
+      rng.ResetSeed(job->GetSeed());
       job->Run(ctx);
       delete job;
-      m_queue->m_mutex.Lock();
-      int pending = --m_queue->m_pending;
-      m_queue->m_mutex.Unlock();
-      if (!pending) m_queue->m_term_cond.Signal();
+      completed++;
     } else {
-      // Terminate worker on NULL job receipt
-      m_queue->m_mutex.Lock();
-      int pending = --m_queue->m_pending;
-      m_queue->m_mutex.Unlock();
-      if (!pending) m_queue->m_term_cond.Signal();
-      break;
+      // Out of work, report completed jobs and wait for more (or terminate)
+      if (!m_queue->waitForJobs(generation, completed)) break;
+      completed = 0;
     }
   }
 }
@@ -45,6 +45,7 @@ protected:
   cAnalyzeJobQueue& m_queue;
   
   int m_jobs;
+  Apto::Array<cAnalyzeJob*> m_submit;   // jobs added since the last RunBatch, queued together
   
   Apto::Mutex m_mutex;
   Apto::ConditionVariable m_cond;
@@ -55,18 +56,26 @@ public:
   
   void AddJob(JobClass* target, void (JobClass::*funJ)(cAvidaContext&))
   {
-    m_mutex.Lock();
-    m_jobs++;
-    m_mutex.Unlock();
-    m_queue.AddJob(new tAnalyzeBatchJob<JobClass>(this, target, funJ));
+    m_submit.Push(new tAnalyzeBatchJob<JobClass>(this, target, funJ));
   }
   
   void RunBatch()
   {
+    m_mutex.Lock();
+    m_jobs += m_submit.GetSize();
+    m_mutex.Unlock();
+    m_queue.AddJobs(m_submit);
+    m_submit.Resize(0);
+    
     m_queue.Start();
+    
+    // Work through queued jobs while waiting, only sleeping once the remaining jobs are all running elsewhere
     m_mutex.Lock();
     while (m_jobs > 0) {
-      m_cond.Wait(m_mutex);
+      m_mutex.Unlock();
+      const bool ran_job = m_queue.RunPendingJob();
+      m_mutex.Lock();
+      if (!ran_job) while (m_jobs > 0) m_cond.Wait(m_mutex);
     }
     m_mutex.Unlock();
   }
@@ -85,10 +94,11 @@ protected:
     {
       tAnalyzeJob<T>::Run(ctx);
       
+      // Signal before unlocking, RunBatch may return and destroy the batch as soon as the mutex is released
       m_batch->m_mutex.Lock();
       m_batch->m_jobs--;
-      m_batch->m_mutex.Unlock();
       m_batch->m_cond.Signal();
+      m_batch->m_mutex.Unlock();
     }
   };
 };
@@ -35,14 +35,15 @@ const double MEMORY_SHRINK_TEST_FACTOR = 4.0;
 
 
 Avida::InstructionSequence::InstructionSequence(const InstructionSequence& seq)
-: GeneticRepresentation(seq), m_seq(seq.GetSize()), m_active_size(seq.GetSize())
+: GeneticRepresentation(seq), m_seq(seq.m_seq), m_active_size(seq.m_active_size), m_mod_begin(0)
+, m_mod_end(seq.m_active_size)
 {
-  for (int i = 0; i < m_active_size; i++)  m_seq[i] = seq[i];
 }
 
 Avida::InstructionSequence::InstructionSequence(const Apto::String& str)
+: m_seq(new InstructionBuffer(str.GetSize())), m_mod_begin(0)
 {
-  m_seq.ResizeClear(str.GetSize());
+  InstructionBuffer& seq = *m_seq;
   int size = 0;
   for (int i = 0; i < str.GetSize(); i++) {
     if (str[i] == '_') continue;
@@ -51,16 +52,17 @@ Avida::InstructionSequence::InstructionSequence(const Apto::String& str)
       case '-':
       case '~':
       case '?':
-        if (!m_seq[size].SetSymbol(str.Substring(i, 2))) continue;
+        if (!seq[size].SetSymbol(str.Substring(i, 2))) continue;
         i++;
         break;
       default:
-        if (!m_seq[size].SetSymbol(str.Substring(i, 1))) continue;
+        if (!seq[size].SetSymbol(str.Substring(i, 1))) continue;
     }
     size++;
   }
   m_active_size = size;
-  m_seq.Resize(size);
+  m_mod_end = size;
+  seq.Resize(size);
 }
 
 Avida::InstructionSequence::~InstructionSequence() { ; }
@@ -149,6 +151,16 @@ bool Avida::Instruction::SetSymbol(const Apto::String& symbol)
 
 
 
+void Avida::InstructionSequence::copyOnWrite()
+{
+  // Copy the whole buffer, sites past the active size are kept for reuse (see cCPUMemory::ResizeOld)
+  const int array_size = m_seq->GetSize();
+  InstructionBufferPtr new_seq(new InstructionBuffer(array_size));
+  for (int i = 0; i < array_size; i++) (*new_seq)[i] = (*m_seq)[i];
+  m_seq = new_seq;
+}
+
+
 void Avida::InstructionSequence::adjustCapacity(int new_size)
 {
   assert(new_size > 0);
@@ -156,14 +168,23 @@ void Avida::InstructionSequence::adjustCapacity(int new_size)
   // Make sure we're really changing the size...
   if (new_size == m_active_size) return;
   
-  const int array_size = m_seq.GetSize();
+  const int array_size = m_seq->GetSize();
   
   // Determine if we need to adjust the allocated array sizes...
   if (new_size > array_size || new_size * MEMORY_SHRINK_TEST_FACTOR < array_size) {
     int new_array_size = (int) (new_size * MEMORY_INCREASE_FACTOR);
     const int new_array_min = new_size + MEMORY_INCREASE_MINIMUM;
 		if (new_array_min > new_array_size) new_array_size = new_array_min;
-    m_seq.Resize(new_array_size);
+    if (m_seq->IsExclusive()) {
+      m_seq->Resize(new_array_size);
+    } else {
+      // Shared storage is never resized in place, move the sites that remain into storage of our own, keeping
+      // those past the active size just as Resize() on the buffer would
+      InstructionBufferPtr new_seq(new InstructionBuffer(new_array_size));
+      const int keep_size = (new_array_size < array_size) ? new_array_size : array_size;
+      for (int i = 0; i < keep_size; i++) (*new_seq)[i] = (*m_seq)[i];
+      m_seq = new_seq;
+    }
   }
   
   // And just change the m_active_size once we're sure it will be in range.
@@ -179,9 +200,11 @@ void Avida::InstructionSequence::prepareInsert(int pos, int num_sites)
   const int old_size = m_active_size;
   const int new_size = m_active_size + num_sites;
   adjustCapacity(new_size);
+  markModified(pos, new_size);
   
   // Shift any sites needed...
-  for (int i = old_size - 1; i >= pos; i--) m_seq[i + num_sites] = m_seq[i];
+  Apto::Array<Instruction>& seq = writableSeq();
+  for (int i = old_size - 1; i >= pos; i--) seq[i + num_sites] = seq[i];
 }
 
 
@@ -189,7 +212,9 @@ void Avida::InstructionSequence::Copy(int to, int from)
 {
   assert(to   >= 0   && to   < m_active_size);
   assert(from >= 0   && from < m_active_size);
-  m_seq[to] = m_seq[from];
+  markModified(to, to + 1);
+  Apto::Array<Instruction>& seq = writableSeq();
+  seq[to] = seq[from];
 }
  
 
@@ -197,7 +222,8 @@ void Avida::InstructionSequence::Copy(int to, int from)
 Apto::String Avida::InstructionSequence::AsString() const
 {
   Apto::StringBuffer out_string;
-  for (int i = 0; i < m_active_size; i++) out_string += m_seq[i].GetSymbol();
+  const InstructionBuffer& seq = *m_seq;
+  for (int i = 0; i < m_active_size; i++) out_string += seq[i].GetSymbol();
 
   return Apto::String(out_string);
 }
@@ -222,26 +248,33 @@ void Avida::InstructionSequence::Resize(int new_size)
   
   const int old_size = m_active_size;
   adjustCapacity(new_size);
+  markModified(old_size, new_size);
   
-  for (int i = old_size; i < new_size; i++) m_seq[i].SetOp(0);
+  if (new_size <= old_size) return;
+  Apto::Array<Instruction>& seq = writableSeq();
+  for (int i = old_size; i < new_size; i++) seq[i].SetOp(0);
 }
 
 void Avida::InstructionSequence::Insert(int pos, const Instruction& inst)
 {
   assert(pos >= 0);
-  assert(pos <= m_seq.GetSize());
+  assert(pos <= m_active_size);
   
   prepareInsert(pos, 1);
-  m_seq[pos] = inst;
+  writableSeq()[pos] = inst;
 }
 
 void Avida::InstructionSequence::Insert(int pos, const InstructionSequence& seq)
 {
   assert(pos >= 0);
-  assert(pos <= m_seq.GetSize());
-  
-  prepareInsert(pos, seq.GetSize());
-  for (int i = 0; i < seq.GetSize(); i++) m_seq[i + pos] = seq[i];
+  assert(pos <= m_active_size);
+  
+  // Hold on to the inserted sites, seq may share (or be) this sequence
+  const InstructionBufferPtr src_seq(seq.m_seq);
+  const int src_size = seq.GetSize();
+  prepareInsert(pos, src_size);
+  Apto::Array<Instruction>& dest_seq = writableSeq();
+  for (int i = 0; i < src_size; i++) dest_seq[i + pos] = (*src_seq)[i];
 }
 
 void Avida::InstructionSequence::Remove(int pos, int num_sites)
@@ -251,7 +284,9 @@ void Avida::InstructionSequence::Remove(int pos, int num_sites)
   assert(pos + num_sites <= m_active_size); // Cannot extend past end of sequence
   
   const int new_size = m_active_size - num_sites;
-  for (int i = pos; i < new_size; i++) m_seq[i] = m_seq[i + num_sites];
+  markModified(pos, new_size);
+  Apto::Array<Instruction>& seq = writableSeq();
+  for (int i = pos; i < new_size; i++) seq[i] = seq[i + num_sites];
   adjustCapacity(new_size);
 }
 
@@ -261,14 +296,19 @@ void Avida::InstructionSequence::Replace(int pos, int num_sites, const Instructi
   assert(num_sites >= 0);                   // Cannot replace negative
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
   
-  const int size_change = seq.GetSize() - num_sites;
+  // Hold on to the replacement sites, seq may share (or be) this sequence
+  const InstructionBufferPtr src_seq(seq.m_seq);
+  const int src_size = seq.GetSize();
+  const int size_change = src_size - num_sites;
   
   // First, get the size right
   if (size_change > 0) prepareInsert(pos, size_change);
   else if (size_change < 0) Remove(pos, -size_change);
   
   // Now just copy everything over!
-  for (int i = 0; i < seq.GetSize(); i++) m_seq[i + pos] = seq[i];
+  markModified(pos, pos + src_size);
+  Apto::Array<Instruction>& dest_seq = writableSeq();
+  for (int i = 0; i < src_size; i++) dest_seq[i + pos] = (*src_seq)[i];
 }
 
 
@@ -345,11 +385,10 @@ void Avida::InstructionSequence::Rotate(int n)
 
 void Avida::InstructionSequence::operator=(const InstructionSequence& other_seq)
 {
+  // Share the other sequence's storage, it will be copied by whichever side writes to it first
+  m_seq = other_seq.m_seq;
   m_active_size = other_seq.m_active_size;
-  m_seq.ResizeClear(m_active_size);
-  
-  // Now that both code arrays are the same size, copy the other one over
-  for (int i = 0; i < m_active_size; i++) m_seq[i] = other_seq[i];
+  markModified(0, m_active_size);
 }
 
 
@@ -361,9 +400,14 @@ bool Avida::InstructionSequence::operator==(const GeneticRepresentation& other_s
   // Make sure the sizes are the same.
   if (m_active_size != seq->m_active_size) return false;
   
+  // Sequences sharing storage are identical
+  const InstructionBuffer& this_seq = *m_seq;
+  const InstructionBuffer& other_seq_buf = *seq->m_seq;
+  if (&this_seq == &other_seq_buf) return true;
+  
   // Then go through line by line.
   for (int i = 0; i < m_active_size; i++)
-    if (m_seq[i] != (*seq)[i]) return false;
+    if (this_seq[i] != other_seq_buf[i]) return false;
   
   return true;
 }
@@ -373,7 +417,8 @@ int Avida::InstructionSequence::FindInst(const Instruction& inst, int start_inde
 {
   assert(start_index < m_active_size);  // Starting search after sequence end.
   
-  for(int i = start_index; i < m_active_size; i++) if (m_seq[i] == inst) return i;
+  const InstructionBuffer& seq = *m_seq;
+  for(int i = start_index; i < m_active_size; i++) if (seq[i] == inst) return i;
   
   // Search failed
   return -1;  
@@ -383,7 +428,8 @@ int Avida::InstructionSequence::FindInst(const Instruction& inst, int start_inde
 int Avida::InstructionSequence::CountInst(const Instruction& inst) const
 {
   int count = 0;
-  for (int i = 0; i < m_active_size; i++) if (m_seq[i] == inst) count++;
+  const InstructionBuffer& seq = *m_seq;
+  for (int i = 0; i < m_active_size; i++) if (seq[i] == inst) count++;
   return count;  
 }
 
@@ -436,7 +482,7 @@ Avida::InstructionSequence Avida::InstructionSequence::Crop(int start, int end)
   
   const int out_length = end - start;
   InstructionSequence out_seq(out_length);
-  for (int i = 0; i < out_length; i++) out_seq[i] = m_seq[i+start];
+  for (int i = 0; i < out_length; i++) out_seq[i] = (*m_seq)[i+start];
   
   return out_seq;
 }
@@ -454,8 +500,8 @@ Avida::InstructionSequence Avida::InstructionSequence::Cut(int start, int end) c
   assert(out_length > 0);             // Can't cut everything!
   
   InstructionSequence out_seq(out_length);
-  for (int i = 0; i < start; i++) out_seq[i] = m_seq[i];
-  for (int i = start; i < out_length; i++) out_seq[i] = m_seq[i + cut_length];
+  for (int i = 0; i < start; i++) out_seq[i] = (*m_seq)[i];
+  for (int i = start; i < out_length; i++) out_seq[i] = (*m_seq)[i + cut_length];
   
   return out_seq;
 }  
@@ -25,7 +25,8 @@
 using namespace std;
 using namespace Avida;
 
-cCPUMemory::cCPUMemory(const cCPUMemory& in_memory) : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize())
+cCPUMemory::cCPUMemory(const cCPUMemory& in_memory)
+  : InstructionSequence(in_memory), m_flag_array(in_memory.GetSize())
 {
   for (int i = 0; i < m_flag_array.GetSize(); i++) m_flag_array[i] = in_memory.m_flag_array[i];
 }
@@ -34,7 +35,7 @@ cCPUMemory::cCPUMemory(const cCPUMemory& in_memory) : InstructionSequence(in_mem
 void cCPUMemory::adjustCapacity(int new_size)
 {
   InstructionSequence::adjustCapacity(new_size);
-  if (m_seq.GetSize() != m_flag_array.GetSize()) m_flag_array.Resize(m_seq.GetSize()); 
+  if (m_seq->GetSize() != m_flag_array.GetSize()) m_flag_array.Resize(m_seq->GetSize()); 
 }
 
 
@@ -47,9 +48,11 @@ void cCPUMemory::prepareInsert(int pos, int num_sites)
   const int old_size = m_active_size;
   const int new_size = m_active_size + num_sites;
   adjustCapacity(new_size);
+  markModified(pos, new_size);
   
   // Shift any sites needed...
-  for (int i = old_size - 1; i >= pos; i--) m_seq[i + num_sites] = m_seq[i];
+  Apto::Array<Instruction>& seq = writableSeq();
+  for (int i = old_size - 1; i >= pos; i--) seq[i + num_sites] = seq[i];
   for (int i = old_size - 1; i >= pos; i--) m_flag_array[i + num_sites] = m_flag_array[i];
 }
 
@@ -69,9 +72,12 @@ void cCPUMemory::Resize(int new_size)
 
   const int old_size = m_active_size;
   adjustCapacity(new_size);
+  markModified(old_size, new_size);
   
+  if (new_size <= old_size) return;
+  Apto::Array<Instruction>& seq = writableSeq();
   for (int i = old_size; i < new_size; i++) {
-    m_seq[i].SetOp(0);
+    seq[i].SetOp(0);
     m_flag_array[i] = 0;
   }
 }
@@ -83,6 +89,7 @@ void cCPUMemory::ResizeOld(int new_size)
 
   const int old_size = m_active_size;
   adjustCapacity(new_size);
+  markModified(old_size, new_size);
 
   for (int i = old_size; i < new_size; i++) m_flag_array[i] = 0;
 }
@@ -91,11 +98,13 @@ void cCPUMemory::ResizeOld(int new_size)
 void cCPUMemory::Copy(int to, int from)
 {
   assert(to >= 0);
-  assert(to < m_seq.GetSize());
+  assert(to < m_active_size);
   assert(from >= 0);
-  assert(from < m_seq.GetSize());
+  assert(from < m_active_size);
   
-  m_seq[to] = m_seq[from];
+  markModified(to, to + 1);
+  Apto::Array<Instruction>& seq = writableSeq();
+  seq[to] = seq[from];
   m_flag_array[to] = m_flag_array[from];
 }
 
@@ -103,21 +112,24 @@ void cCPUMemory::Copy(int to, int from)
 void cCPUMemory::Insert(int pos, const Instruction& inst)
 {
   assert(pos >= 0);
-  assert(pos <= m_seq.GetSize());
+  assert(pos <= m_active_size);
 
   prepareInsert(pos, 1);
-  m_seq[pos] = inst;
+  writableSeq()[pos] = inst;
   m_flag_array[pos] = 0;
 }
 
 void cCPUMemory::Insert(int pos, const InstructionSequence& genome)
 {
   assert(pos >= 0);
-  assert(pos <= m_seq.GetSize());
-
-  prepareInsert(pos, genome.GetSize());
-  for (int i = 0; i < genome.GetSize(); i++) {
-    m_seq[i + pos] = genome[i];
+  assert(pos <= m_active_size);
+
+  // Hold on to the inserted sites, genome may share (or be) this memory
+  const InstructionSequence src_genome(genome);
+  prepareInsert(pos, src_genome.GetSize());
+  Apto::Array<Instruction>& seq = writableSeq();
+  for (int i = 0; i < src_genome.GetSize(); i++) {
+    seq[i + pos] = src_genome[i];
     m_flag_array[i + pos] = 0;
   }
 }
@@ -129,8 +141,10 @@ void cCPUMemory::Remove(int pos, int num_sites)
   assert(pos + num_sites <= m_active_size); // Cannot extend past end of genome.
 
   const int new_size = m_active_size - num_sites;
+  markModified(pos, new_size);
+  Apto::Array<Instruction>& seq = writableSeq();
   for (int i = pos; i < new_size; i++) {
-    m_seq[i] = m_seq[i + num_sites];
+    seq[i] = seq[i + num_sites];
     m_flag_array[i] = m_flag_array[i + num_sites];
   }
   adjustCapacity(new_size);
@@ -142,40 +156,60 @@ void cCPUMemory::Replace(int pos, int num_sites, const InstructionSequence& geno
   assert(num_sites >= 0);                   // Cannot replace negative
   assert(pos + num_sites <= m_active_size); // Cannot extend past end!
   
-  const int size_change = genome.GetSize() - num_sites;
+  // Hold on to the replacement sites, genome may share (or be) this memory
+  const InstructionSequence src_genome(genome);
+  const int size_change = src_genome.GetSize() - num_sites;
   
   // First, get the size right
   if (size_change > 0) prepareInsert(pos, size_change);
   else if (size_change < 0) Remove(pos, -size_change);
   
   // Now just copy everything over!
-  for (int i = 0; i < genome.GetSize(); i++) {
-    m_seq[i + pos] = genome[i];
+  markModified(pos, pos + src_genome.GetSize());
+  Apto::Array<Instruction>& seq = writableSeq();
+  for (int i = 0; i < src_genome.GetSize(); i++) {
+    seq[i + pos] = src_genome[i];
     m_flag_array[i + pos] = 0;
   }
 }
 
 
+// Circular replacement is built from Insert, Replace and Remove, which each mark their own sites, but a replacement that
+// wraps around moves every site, so the whole memory is marked
+void cCPUMemory::Replace(const InstructionSequence& genome, int begin, int end)
+{
+  InstructionSequence::Replace(genome, begin, end);
+  if (end < begin) markModified(0, m_active_size);
+  else markModified(begin, m_active_size);
+}
+
+
+void cCPUMemory::Rotate(int n)
+{
+  InstructionSequence::Rotate(n);
+  markModified(0, m_active_size);
+}
+
+
 void cCPUMemory::operator=(const cCPUMemory& other_memory)
 {
-  adjustCapacity(other_memory.m_active_size);
+  if (this == &other_memory) return;
   
-  // Fill in the new information...
-  for (int i = 0; i < m_active_size; i++) {
-    m_seq[i] = other_memory.m_seq[i];
-    m_flag_array[i] = other_memory.m_flag_array[i];
-  }
+  // Share the instructions, only the flags are copied
+  InstructionSequence::operator=(other_memory);
+  if (m_seq->GetSize() != m_flag_array.GetSize()) m_flag_array.Resize(m_seq->GetSize());
+  markModified(0, m_active_size);
+  
+  for (int i = 0; i < m_active_size; i++) m_flag_array[i] = other_memory.m_flag_array[i];
 }
 
 
 void cCPUMemory::operator=(const InstructionSequence& other_genome)
 {
-  adjustCapacity(other_genome.GetSize());
+  // Share the instructions, only the flags are copied
+  InstructionSequence::operator=(other_genome);
+  if (m_seq->GetSize() != m_flag_array.GetSize()) m_flag_array.Resize(m_seq->GetSize());
+  markModified(0, m_active_size);
   
-  // Fill in the new information...
-  for (int i = 0; i < m_active_size; i++) {
-    m_seq[i] = other_genome[i];
-    m_flag_array[i] = 0;
-  }
+  for (int i = 0; i < m_active_size; i++) m_flag_array[i] = 0;
 }
-
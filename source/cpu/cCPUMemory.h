@@ -46,10 +46,12 @@ private:
 public:
   cCPUMemory(const cCPUMemory& in_memory);
   cCPUMemory(const InstructionSequence& in_genome) : InstructionSequence(in_genome), m_flag_array(in_genome.GetSize()) { ; }
-  explicit cCPUMemory(int size = 1)  : InstructionSequence(size), m_flag_array(size) { ClearFlags(); }
+  explicit cCPUMemory(int size = 1) : InstructionSequence(size), m_flag_array(size) { ClearFlags(); }
   cCPUMemory(const Apto::String& in_string) : InstructionSequence(in_string), m_flag_array(in_string.GetSize()) { ; }
   ~cCPUMemory() { ; }
 
+  // The modified range (GetModifiedBegin(), GetModifiedEnd(), ClearModified()) is kept by InstructionSequence
+
   inline bool FlagCopied(int pos) const     { return (MASK_COPIED   & m_flag_array[pos]) != 0; }
   inline bool FlagMutated(int pos) const    { return (MASK_MUTATED  & m_flag_array[pos]) != 0; }
   inline bool FlagExecuted(int pos) const   { return (MASK_EXECUTED & m_flag_array[pos]) != 0; }
@@ -74,8 +76,10 @@ public:
   
   void Clear()
 	{
+    markModified(0, m_active_size);
+    Apto::Array<Avida::Instruction>& seq = writableSeq();
 		for (int i = 0; i < m_active_size; i++) {
-			m_seq[i].SetOp(0);
+			seq[i].SetOp(0);
 			m_flag_array[i] = 0;
 		}
 	}
@@ -90,6 +94,8 @@ public:
   void Insert(int pos, const InstructionSequence& genome);
   void Remove(int pos, int num_sites = 1);
   void Replace(int pos, int num_sites, const InstructionSequence& genome);
+  void Replace(const InstructionSequence& genome, int begin, int end);
+  void Rotate(int n);
 
   void operator=(const cCPUMemory& other_memory);
   void operator=(const InstructionSequence& other_genome);
@@ -80,6 +80,24 @@ cCPUTestInfo& cCPUTestInfo::operator=(const cCPUTestInfo& test_info)
 }
 
 
+// Copies only the input settings (including the resource history), leaving the outputs and test organisms alone
+void cCPUTestInfo::CopySettings(const cCPUTestInfo& test_info)
+{
+  assert(generation_tests == test_info.generation_tests);
+  trace_task_order = test_info.trace_task_order;
+  use_random_inputs = test_info.use_random_inputs;
+  use_manual_inputs = test_info.use_manual_inputs;
+  manual_inputs = test_info.manual_inputs;
+  m_tracer = test_info.m_tracer;
+  m_mut_rates = test_info.m_mut_rates;
+  m_cur_sg = test_info.m_cur_sg;
+  m_res_method = test_info.m_res_method;
+  m_res = test_info.m_res;
+  m_res_update = test_info.m_res_update;
+  m_res_cpu_cycle_offset = test_info.m_res_cpu_cycle_offset;
+}
+
+
 cCPUTestInfo::~cCPUTestInfo()
 {
   for (int i = 0; i < generation_tests; i++) {
@@ -82,6 +82,7 @@ public:
   ~cCPUTestInfo();
 
   void Clear();
+  void CopySettings(const cCPUTestInfo& test_info);
  
   // Input Setup
   void TraceTaskOrder(bool _trace=true) { trace_task_order = _trace; }
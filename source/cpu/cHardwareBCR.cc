@@ -35,6 +35,7 @@
 #include "cOrganism.h"
 #include "cPhenotype.h"
 #include "cPopulation.h"
+#include "cProfiler.h"
 #include "cStateGrid.h"
 #include "cWorld.h"
 
@@ -613,8 +614,16 @@ bool cHardwareBCR::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instructi
   // instruction execution count incremeneted
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
   
-  // And execute it.
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  // And execute it, timing a sample of the instructions when profiling.
+  bool exec_success;
+  if (m_inst_profile && m_inst_profile->SampleNext()) {
+    const cInstProfile::Cycles start = cInstProfile::ReadCycles();
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+    m_inst_profile->AddSample(actual_inst.GetOp(), cInstProfile::ReadCycles() - start);
+  } else {
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  }
+  if (m_inst_profile && exec_success) m_inst_profile->CountInst(actual_inst.GetOp());
   
   // decremenet if the instruction was not executed successfully
   if (exec_success == false) {
@@ -776,7 +785,7 @@ void cHardwareBCR::PrintMiniTraceStatus(cAvidaContext& ctx, ostream& fp)
   cString next_name(GetInstSet().GetName(getIP().GetInst()));
   fp << next_name << " ";
   // any trailing nops (up to NUM_REGISTERS)
-  cCPUMemory& memory = m_mem_array[0];
+  const cCPUMemory& memory = m_mem_array[0];
   int pos = getIP().Position();
   Apto::Array<int, Apto::Smart> seq;
   seq.Resize(0);
@@ -813,7 +822,7 @@ void cHardwareBCR::FindLabelStart(Head& head, Head& default_pos, bool mark_execu
     return;
   }
   
-  cCPUMemory& memory = head.GetMemory();
+  const cCPUMemory& memory = head.GetMemory();
   int pos = 0;
   
   while (pos < memory.GetSize()) {
@@ -837,7 +846,7 @@ void cHardwareBCR::FindLabelStart(Head& head, Head& default_pos, bool mark_execu
           size_matched++; // Increment size matched so that it includes the label instruction
           const int start = pos - size_matched;
           const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
+          for (int i = 0; i < size_matched && i < max; i++) head.GetMemory().SetFlagExecuted(start + i);
         }
         head.SetPosition(pos - 1);
         return;
@@ -862,7 +871,7 @@ void cHardwareBCR::FindNopSequenceStart(Head& head, Head& default_pos, bool mark
     return;
   }
   
-  cCPUMemory& memory = head.GetMemory();
+  const cCPUMemory& memory = head.GetMemory();
   int pos = 0;
   
   while (pos < memory.GetSize()) {
@@ -884,7 +893,7 @@ void cHardwareBCR::FindNopSequenceStart(Head& head, Head& default_pos, bool mark
         if (mark_executed) {
           const int start = pos - size_matched;
           const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
+          for (int i = 0; i < size_matched && i < max; i++) head.GetMemory().SetFlagExecuted(start + i);
         }
         head.SetPosition(pos - 1);
         return;
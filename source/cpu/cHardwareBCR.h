@@ -103,6 +103,8 @@ private:
     inline void Reset(cHardwareBCR* hw, int pos, unsigned int ms, bool is_gene)
       { m_hw = hw; m_pos = pos; m_ms = ms; m_is_gene = is_gene; }
     
+    inline const cCPUMemory& GetMemory() const
+      { return (m_is_gene) ? m_hw->m_genes[m_ms].memory : m_hw->m_mem_array[m_ms]; }
     inline cCPUMemory& GetMemory() { return (m_is_gene) ? m_hw->m_genes[m_ms].memory : m_hw->m_mem_array[m_ms]; }
     
     inline void Adjust();
@@ -122,10 +124,10 @@ private:
     
     inline void Advance() { m_pos++; Adjust(); }
     
-    inline const Instruction& GetInst() { return GetMemory()[m_pos]; }
-    inline const Instruction& GetInst(int offset) { return GetMemory()[m_pos + offset]; }
-    inline Instruction NextInst();
-    inline Instruction PrevInst();
+    inline const Instruction& GetInst() const { return GetMemory()[m_pos]; }
+    inline const Instruction& GetInst(int offset) const { return GetMemory()[m_pos + offset]; }
+    inline Instruction NextInst() const;
+    inline Instruction PrevInst() const;
     
     inline void SetInst(const Instruction& value) { GetMemory()[m_pos] = value; }
     inline void InsertInst(const Instruction& inst) { GetMemory().Insert(m_pos, inst); }
@@ -153,9 +155,9 @@ private:
     inline bool operator!=(const Head& rhs) const { return !operator==(rhs); }
     
     // Bool Tests...
-    inline bool AtFront() { return (m_pos == 0); }
-    inline bool AtEnd() { return (m_pos + 1 == GetMemory().GetSize()); }
-    inline bool InMemory() { return (m_pos >= 0 && m_pos < GetMemory().GetSize()); }
+    inline bool AtFront() const { return (m_pos == 0); }
+    inline bool AtEnd() const { return (m_pos + 1 == GetMemory().GetSize()); }
+    inline bool InMemory() const { return (m_pos >= 0 && m_pos < GetMemory().GetSize()); }
   };
   
   
@@ -623,12 +625,12 @@ inline bool cHardwareBCR::Head::operator==(const Head& rhs) const
   return m_hw == rhs.m_hw && m_pos == rhs.m_pos && m_ms == rhs.m_ms && m_is_gene == rhs.m_is_gene;
 }
 
-inline Instruction cHardwareBCR::Head::PrevInst()
+inline Instruction cHardwareBCR::Head::PrevInst() const
 {
   return (AtFront()) ? GetMemory()[GetMemory().GetSize() - 1] : GetMemory()[m_pos - 1];
 }
 
-inline Instruction cHardwareBCR::Head::NextInst()
+inline Instruction cHardwareBCR::Head::NextInst() const
 {
   return (AtEnd()) ? m_hw->GetInstSet().GetInstError() : GetMemory()[m_pos + 1];
 }
@@ -28,6 +28,7 @@
 #include "cAvidaContext.h"
 #include "cCodeLabel.h"
 #include "cCPUTestInfo.h"
+#include "cDivideTestQueue.h"
 #include "cEnvironment.h"
 #include "cHardwareManager.h"
 #include "cHardwareStatusPrinter.h"
@@ -47,7 +48,7 @@ using namespace AvidaTools;
 
 
 cHardwareBase::cHardwareBase(cWorld* world, cOrganism* in_organism, cInstSet* inst_set)
-: m_world(world), m_organism(in_organism), m_inst_set(inst_set), m_tracer(NULL)
+: m_world(world), m_organism(in_organism), m_inst_set(inst_set), m_tracer(NULL), m_inst_profile(NULL)
 , m_minitrace(false), m_microtrace(false), m_topnavtrace(false)
 , m_has_costs(inst_set->HasCosts()), m_has_ft_costs(inst_set->HasFTCosts()) , m_has_energy_costs(m_inst_set->HasEnergyCosts())
 , m_has_res_costs(m_inst_set->HasResCosts()), m_has_fem_res_costs(m_inst_set->HasFemResCosts())
@@ -881,19 +882,16 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-  cCPUTestInfo test_info;
-  test_info.UseRandomInputs();
-  testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
-  const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
+  cDivideTestQueue::sResult test_result;
+  m_world->GetPopulation().GetDivideTestQueue().TestGenome(ctx, m_organism->OffspringGenome(), test_result);
+  const double child_fitness = test_result.fitness;
   
   bool revert = false;
   bool sterilize = false;
   
   // If implicit mutations are turned off, make sure this won't spawn one.
   if (m_organism->GetSterilizeUnstable() == true) {
-    if (test_info.GetMaxDepth() > 0) sterilize = true;
+    if (test_result.max_depth > 0) sterilize = true;
   }
   
   if (child_fitness == 0.0) {
@@ -920,7 +918,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
     RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-    const Apto::Array<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+    const Apto::Array<int>& childtasks = test_result.task_counts;
     bool del = false;
     bool added = false;
     for (int i=0; i<childtasks.GetSize(); i++)
@@ -945,7 +943,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const Apto::Array<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const Apto::Array<int>& child_tasks = test_result.task_counts;
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -993,22 +991,19 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   const double neut_min = parent_fitness * (1.0 - m_organism->GetNeutralMin());
   const double neut_max = parent_fitness * (1.0 + m_organism->GetNeutralMax());
   
-  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
-  cCPUTestInfo test_info;
-  test_info.UseRandomInputs();
-  testcpu->TestGenome(ctx, test_info, m_organism->OffspringGenome());
-  const double child_fitness = test_info.GetGenotypeFitness();
-  delete testcpu;
+  cDivideTestQueue::sResult test_result;
+  m_world->GetPopulation().GetDivideTestQueue().TestGenome(ctx, m_organism->OffspringGenome(), test_result);
+  const double child_fitness = test_result.fitness;
   
   bool revert = false;
   bool sterilize = false;
   
   // If implicit mutations are turned off, make sure this won't spawn one.
   if (m_organism->GetSterilizeUnstable() > 0) {
-    if (test_info.GetMaxDepth() > 0) sterilize = true;
+    if (test_result.max_depth > 0) sterilize = true;
   }
   
-  if (m_organism->GetSterilizeUnstable() > 1 && !test_info.IsViable()) {
+  if (m_organism->GetSterilizeUnstable() > 1 && !test_result.is_viable) {
     sterilize = true;
   }
   
@@ -1034,7 +1029,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
 	  RorS = 2;
   // check if child has lost any tasks parent had AND not gained any new tasks
   if (RorS) {
-	  const Apto::Array<int>& childtasks = test_info.GetTestPhenotype().GetLastTaskCount();
+	  const Apto::Array<int>& childtasks = test_result.task_counts;
 	  bool del = false;
 	  bool added = false;
 	  for (int i=0; i<childtasks.GetSize(); i++)
@@ -1059,7 +1054,7 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   // is not used.
   if (m_organism->GetRevertEquals() != 0) {
     if (ctx.GetRandom().P(m_organism->GetRevertEquals())) {
-      const Apto::Array<int>& child_tasks = test_info.GetTestPhenotype().GetLastTaskCount();
+      const Apto::Array<int>& child_tasks = test_result.task_counts;
       if (child_tasks[child_tasks.GetSize() - 1] >= 1) {
         revert = true;
         m_world->GetStats().AddNewTaskCount(child_tasks.GetSize() - 1);
@@ -1080,6 +1075,26 @@ bool cHardwareBase::Divide_TestFitnessMeasures1(cAvidaContext& ctx)
   return (!sterilize) && revert;
 }
 
+/*
+ Hold the current divide until the end of the update when DIVIDE_TEST_DEFER is set and the offspring must be tested.
+ Returns true if the divide was deferred, in which case the caller must stop processing the divide and leave the
+ remainder to its Divide_CompleteDeferred() implementation.  Perfect copies and genomes with known results are
+ never deferred.
+ */
+bool cHardwareBase::Divide_DeferFitnessTest(cAvidaContext& ctx)
+{
+  if (ctx.GetAnalyzeMode() || m_organism->GetTestOnDivide() == false) return false;
+  
+  cDivideTestQueue& test_queue = m_world->GetPopulation().GetDivideTestQueue();
+  if (!test_queue.IsDeferring()) return false;
+  
+  if (m_organism->OffspringGenome() == m_organism->GetGenome()) return false;
+  if (test_queue.HasResult(m_organism->OffspringGenome())) return false;
+  
+  test_queue.DeferDivide(m_organism);
+  return true;
+}
+
 int cHardwareBase::PointMutate(cAvidaContext& ctx, double override_mut_rate)
 {
   const int max_genome_size = m_world->GetConfig().MAX_GENOME_SIZE.Get();
@@ -39,6 +39,7 @@ class cAvidaContext;
 class cCodeLabel;
 class cCPUMemory;
 class cHeadCPU;
+class cInstProfile;
 class cMutation;
 class cOrganism;
 class cString;
@@ -56,6 +57,7 @@ protected:
   cInstSet* m_inst_set;             // Instruction set being used.
 
   HardwareTracerPtr m_tracer;        // Set this if you want execution traced.
+  cInstProfile* m_inst_profile;     // Set this if you want execution profiled (population hardware only).
   Apto::Array<char, Apto::Smart> m_microtracer;
   Apto::Array<int, Apto::Smart> m_navtraceloc;
   Apto::Array<int, Apto::Smart> m_navtracefacing;
@@ -137,6 +139,9 @@ public:
   int Divide_DoMutations(cAvidaContext& ctx, double mut_multiplier = 1.0, const int maxmut = INT_MAX);
   bool Divide_TestFitnessMeasures(cAvidaContext& ctx);
   
+  //! Finish a divide that was held by Divide_DeferFitnessTest(), called by cDivideTestQueue at the start of post-update processing.
+  virtual void Divide_CompleteDeferred(cAvidaContext&) { ; }
+  
   // --------  Helper methods  --------
   virtual int GetType() const = 0;
   virtual bool SupportsSpeculative() const = 0;
@@ -144,6 +149,7 @@ public:
   virtual void PrintMiniTraceStatus(cAvidaContext& ctx, std::ostream& fp) = 0;
   virtual void PrintMiniTraceSuccess(std::ostream& fp, const int exec_success) = 0;
   void SetTrace(HardwareTracerPtr tracer) { m_tracer = tracer; }
+  void SetInstProfile(cInstProfile* profile) { m_inst_profile = profile; }
   void SetMiniTrace(const cString& filename);
   void SetMicroTrace() { m_microtrace = true; } 
   void SetTopNavTrace(bool nav_trace) { m_topnavtrace = nav_trace; }
@@ -244,6 +250,16 @@ protected:
   void ResizeCostArrays(int new_size);
 
   // --------  Core Execution Methods  --------
+  // Features that SingleProcess implementations may compile out of their execution loop.  All but tracing are fixed
+  // when the hardware is constructed, and each combination selects a separate instantiation of the loop.
+  enum {
+    SP_COSTS = 0x1,
+    SP_PROMOTERS = 0x2,
+    SP_REGULATION = 0x4,
+    SP_TRACE = 0x8,
+    SP_NUM_VARIANTS = 0x10
+  };
+  
   bool SingleProcess_PayPreCosts(cAvidaContext& ctx, const Instruction& cur_inst, const int thread_id);
   void SingleProcess_PayPostResCosts(cAvidaContext& ctx, const Instruction& cur_inst);
   void SingleProcess_SetPostCPUCosts(cAvidaContext& ctx, const Instruction& cur_inst, const int thread_id);
@@ -286,6 +302,7 @@ protected:
   bool Divide_CheckViable(cAvidaContext& ctx, const int parent_size, const int child_size, bool using_repro = false);
   unsigned Divide_DoExactMutations(cAvidaContext& ctx, double mut_multiplier = 1.0, const int pointmut = INT_MAX);
   bool Divide_TestFitnessMeasures1(cAvidaContext& ctx);
+  bool Divide_DeferFitnessTest(cAvidaContext& ctx);
   
 
 private:
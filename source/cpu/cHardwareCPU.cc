@@ -38,6 +38,7 @@
 #include "cPhenotype.h"
 #include "cPopulation.h"
 #include "cPopulationCell.h"
+#include "cProfiler.h"
 #include "cReaction.h"
 #include "cReactionLib.h"
 #include "cReactionProcess.h"
@@ -744,6 +745,7 @@ tInstLib<cHardwareCPU::tMethod>* cHardwareCPU::initInstLib(void)
 
 cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_organism, cInstSet* in_inst_set)
 : cHardwareBase(world, in_organism, in_inst_set)
+, m_label_index(*in_inst_set)
 , m_last_cell_data(false, 0)
 {
   m_functions = s_inst_slib->GetFunctions();
@@ -757,6 +759,9 @@ cHardwareCPU::cHardwareCPU(cAvidaContext& ctx, cWorld* world, cOrganism* in_orga
   m_promoters_enabled = m_world->GetConfig().PROMOTERS_ENABLED.Get();
   m_constitutive_regulation = m_world->GetConfig().CONSTITUTIVE_REGULATION.Get();
   
+  m_sp_features = ((m_has_any_costs) ? SP_COSTS : 0) | ((m_promoters_enabled) ? SP_PROMOTERS : 0) |
+                  ((m_constitutive_regulation) ? SP_REGULATION : 0);
+  
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
   // Initialize memory...
@@ -817,9 +822,10 @@ void cHardwareCPU::internalReset()
     m_promoter_index = -1; // Meaning the last promoter was nothing
     m_promoter_offset = 0;
     m_promoters.Resize(0);
-    for (int i=0; i< m_memory.GetSize(); i++)
+    const cCPUMemory& memory = m_memory;
+    for (int i=0; i< memory.GetSize(); i++)
     {
-      if (m_memory[i] == promoter_inst)
+      if (memory[i] == promoter_inst)
       {
         int code = Numberate(i-1, -1, m_world->GetConfig().PROMOTER_CODE_SIZE.Get());
         m_promoters.Push( cPromoter(i,code) );
@@ -878,6 +884,14 @@ void cHardwareCPU::cLocalThread::Reset(cHardwareBase* in_hardware, int in_id)
 // to be as optimized as possible.  This is the heart of avida.
 
 bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
+{
+  const int features = (m_tracer) ? (m_sp_features | SP_TRACE) : m_sp_features;
+  return (this->*s_single_process[features])(ctx, speculative);
+}
+
+// Each combination of SP_ features is a separate instantiation, so the feature tests below are resolved at compile
+// time and the common configuration (no costs, promoters, regulation, or tracing) runs without them.
+template <int FEATURES> bool cHardwareCPU::singleProcess(cAvidaContext& ctx, bool speculative)
 {
   assert(!speculative || (speculative && !m_thread_slicing_parallel));
   
@@ -895,11 +909,11 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
   // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) Inst_Terminate(ctx);
+  if ((FEATURES & SP_PROMOTERS) && phenotype.GetCPUCyclesUsed() == 0) Inst_Terminate(ctx);
   
   // Count the cpu cycles used
   phenotype.IncCPUCyclesUsed();
-  if (!m_world->GetConfig().NO_CPU_CYCLE_TIME.Get()) phenotype.IncTimeUsed();
+  if (!m_no_cpu_cycle_time) phenotype.IncTimeUsed();
   
   int num_threads = m_threads.GetSize();
   
@@ -925,7 +939,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     
     // Print the status of this CPU at each step...
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this);
     
     // Find the instruction to be executed
     const Instruction cur_inst = ip.GetInst();
@@ -941,13 +955,15 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+    if (FEATURES & SP_COSTS) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
     
     // Constitutive regulation applied here
-    if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+    if (FEATURES & SP_REGULATION) Inst_SenseRegulate(ctx);
     
     // If there are no active promoters and a certain mode is set, then don't execute any further instructions
-    if (m_promoters_enabled && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) exec = false;
+    if ((FEATURES & SP_PROMOTERS) && m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2 && m_promoter_index == -1) {
+      exec = false;
+    }
     
     // Now execute the instruction...
     if (exec == true) {
@@ -968,10 +984,10 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       getIP().SetFlagExecuted();
       
       // Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if (FEATURES & SP_PROMOTERS) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
-        if (SingleProcess_ExecuteInst(ctx, cur_inst)) { 
+        if (SingleProcess_ExecuteInst(ctx, cur_inst) && (FEATURES & SP_COSTS)) { 
           SingleProcess_PayPostResCosts(ctx, cur_inst); 
           SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
         }
@@ -988,7 +1004,7 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if (FEATURES & SP_PROMOTERS) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) Inst_Terminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() && (m_threads[m_cur_thread].GetPromoterInstExecuted() >= m_world->GetConfig().PROMOTER_INST_MAX.Get())) 
@@ -1029,6 +1045,17 @@ bool cHardwareCPU::SingleProcess(cAvidaContext& ctx, bool speculative)
   return !m_spec_die;
 }
 
+const cHardwareCPU::tSingleProcess cHardwareCPU::s_single_process[SP_NUM_VARIANTS] = {
+  &cHardwareCPU::singleProcess<0x0>, &cHardwareCPU::singleProcess<0x1>,
+  &cHardwareCPU::singleProcess<0x2>, &cHardwareCPU::singleProcess<0x3>,
+  &cHardwareCPU::singleProcess<0x4>, &cHardwareCPU::singleProcess<0x5>,
+  &cHardwareCPU::singleProcess<0x6>, &cHardwareCPU::singleProcess<0x7>,
+  &cHardwareCPU::singleProcess<0x8>, &cHardwareCPU::singleProcess<0x9>,
+  &cHardwareCPU::singleProcess<0xA>, &cHardwareCPU::singleProcess<0xB>,
+  &cHardwareCPU::singleProcess<0xC>, &cHardwareCPU::singleProcess<0xD>,
+  &cHardwareCPU::singleProcess<0xE>, &cHardwareCPU::singleProcess<0xF>
+};
+
 // This method will handle the actual execution of an instruction
 // within a single process, once that function has been finalized.
 bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst) 
@@ -1047,8 +1074,16 @@ bool cHardwareCPU::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instructi
   // instruction execution count incremented
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
 	
-  // And execute it.
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  // And execute it, timing a sample of the instructions when profiling.
+  bool exec_success;
+  if (m_inst_profile && m_inst_profile->SampleNext()) {
+    const cInstProfile::Cycles start = cInstProfile::ReadCycles();
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+    m_inst_profile->AddSample(actual_inst.GetOp(), cInstProfile::ReadCycles() - start);
+  } else {
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  }
+  if (m_inst_profile && exec_success) m_inst_profile->CountInst(actual_inst.GetOp());
   
   // NOTE: Organism may be dead now if instruction executed killed it (such as some divides, "die", or "kazi")
   
@@ -1166,19 +1201,20 @@ cHeadCPU cHardwareCPU::FindLabel(int direction)
   }
   
   // Call special functions depending on if jump is forwards or backwards.
+  m_label_index.Update(m_memory);
   int found_pos = 0;
   if ( direction < 0 ) {
-    found_pos = FindLabel_Backward(search_label, m_memory, inst_ptr.GetPosition() - search_label.GetSize());
+    found_pos = m_label_index.FindBackward(search_label, inst_ptr.GetPosition() - search_label.GetSize());
   }
   
   // Jump forward.
   else if (direction > 0) {
-    found_pos = FindLabel_Forward(search_label, m_memory, inst_ptr.GetPosition());
+    found_pos = m_label_index.FindForward(search_label, inst_ptr.GetPosition());
   }
   
   // Jump forward from the very beginning.
   else {
-    found_pos = FindLabel_Forward(search_label, m_memory, 0);
+    found_pos = m_label_index.FindForward(search_label, 0);
   }
   
   // Return the last line of the found label, if it was found.
@@ -1189,166 +1225,6 @@ cHeadCPU cHardwareCPU::FindLabel(int direction)
 }
 
 
-// Search forwards for search_label from _after_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-
-int cHardwareCPU::FindLabel_Forward(const cCodeLabel & search_label,
-                                    const InstructionSequence & search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize() && pos >= 0);
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos += label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos < search_genome.GetSize()) {
-    
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop(search_genome[pos])) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > search_start &&
-             m_inst_set->IsNop( search_genome[start_pos - 1] )) {
-        start_pos--;
-      }
-      while (end_pos < search_genome.GetSize() &&
-             m_inst_set->IsNop( search_genome[end_pos] )) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      int offset = start_pos;
-      for (offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod( search_genome[offset + matches] )) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        // pos = end_pos;
-        pos = label_size + offset;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just after the current label being
-      // checked.
-      pos = end_pos;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos += label_size;
-  }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
-}
-
-// Search backwards for search_label from _before_ position pos in the
-// memory.  Return the first line _after_ the the found label.  It is okay
-// to find search label's match inside another label.
-
-int cHardwareCPU::FindLabel_Backward(const cCodeLabel & search_label,
-                                     const InstructionSequence & search_genome, int pos)
-{
-  assert (pos < search_genome.GetSize());
-  
-  int search_start = pos;
-  int label_size = search_label.GetSize();
-  bool found_label = false;
-  
-  // Move off the template we are on.
-  pos -= label_size;
-  
-  // Search until we find the complement or exit the memory.
-  while (pos >= 0) {
-    // If we are within a label, rewind to the beginning of it and see if
-    // it has the proper sub-label that we're looking for.
-    
-    if (m_inst_set->IsNop( search_genome[pos] )) {
-      // Find the start and end of the label we're in the middle of.
-      
-      int start_pos = pos;
-      int end_pos = pos + 1;
-      while (start_pos > 0 && m_inst_set->IsNop(search_genome[start_pos - 1])) {
-        start_pos--;
-      }
-      while (end_pos < search_start &&
-             m_inst_set->IsNop(search_genome[end_pos])) {
-        end_pos++;
-      }
-      int test_size = end_pos - start_pos;
-      
-      // See if this label has the proper sub-label within it.
-      int max_offset = test_size - label_size + 1;
-      for (int offset = start_pos; offset < start_pos + max_offset; offset++) {
-        
-        // Test the number of matches for this offset.
-        int matches;
-        for (matches = 0; matches < label_size; matches++) {
-          if (search_label[matches] !=
-              m_inst_set->GetNopMod(search_genome[offset + matches])) {
-            break;
-          }
-        }
-        
-        // If we have found it, break out of this loop!
-        if (matches == label_size) {
-          found_label = true;
-          break;
-        }
-      }
-      
-      // If we've found the complement label, set the position to the end of
-      // the label we found it in, and break out.
-      
-      if (found_label == true) {
-        pos = end_pos;
-        break;
-      }
-      
-      // We haven't found it; jump pos to just before the current label
-      // being checked.
-      pos = start_pos - 1;
-    }
-    
-    // Jump up a block to the next possible point to find a label,
-    pos -= label_size;
-  }
-  
-  // If the label was not found return a -1.
-  if (found_label == false) pos = -1;
-  
-  return pos;
-}
-
 // Search for 'in_label' anywhere in the hardware.
 cHeadCPU cHardwareCPU::FindLabel(const cCodeLabel & in_label, int direction)
 {
@@ -1782,6 +1658,12 @@ bool cHardwareCPU::Divide_Main(cAvidaContext& ctx, const int div_point,
   // Handle Divide Mutations...
   Divide_DoMutations(ctx, mut_multiplier);
   
+  // If the offspring test has been deferred, the rest of the divide is handled by Divide_CompleteDeferred()
+  if (Divide_DeferFitnessTest(ctx)) {
+    m_mal_active = false;
+    return true;
+  }
+  
   // Many tests will require us to run the offspring through a test CPU;
   // this is, for example, to see if mutations need to be reverted or if
   // lineages need to be updated.
@@ -1816,6 +1698,31 @@ bool cHardwareCPU::Divide_Main(cAvidaContext& ctx, const int div_point,
   return true;
 }
 
+void cHardwareCPU::Divide_CompleteDeferred(cAvidaContext& ctx)
+{
+  Divide_TestFitnessMeasures1(ctx);
+  
+  if (m_world->GetConfig().DIVIDE_METHOD.Get() != DIVIDE_METHOD_OFFSPRING) {
+    // reset first time instruction costs
+    for (int i = 0; i < m_inst_ft_cost.GetSize(); i++) {
+      m_inst_ft_cost[i] = m_inst_set->GetFTCost(Instruction(i));
+    }
+  }
+  
+  // Activate the child
+  bool parent_alive = m_organism->ActivateDivide(ctx);
+  
+  // Do more work if the parent lives through the birth of the offspring
+  if (parent_alive) {
+    if ( (m_world->GetConfig().EPIGENETIC_METHOD.Get() == EPIGENETIC_METHOD_PARENT) 
+        || (m_world->GetConfig().EPIGENETIC_METHOD.Get() == EPIGENETIC_METHOD_BOTH) ) {
+      InheritState(*this);  
+    }
+    
+    if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) Reset(ctx);
+  }
+}
+
 /*
  Almost the same as Divide_Main, but resamples reverted offspring.
  
@@ -3293,8 +3200,9 @@ void cHardwareCPU::Divide_DoTransposons(cAvidaContext& ctx)
   
   // Count the number of transposons that are marked as executed
   int tr_count = 0;
-  for (int i = 0; i < m_memory.GetSize(); i++) {
-    if (m_memory.FlagExecuted(i) && (m_memory[i] == transposon_inst)) tr_count++;
+  const cCPUMemory& memory = m_memory;
+  for (int i = 0; i < memory.GetSize(); i++) {
+    if (memory.FlagExecuted(i) && (memory[i] == transposon_inst)) tr_count++;
   }
   
   for (int i = 0; i < tr_count; i++) {
@@ -7363,7 +7271,7 @@ int cHardwareCPU::Numberate(int _pos, int _dir, int _num_bits)
   assert(j >=0);
   assert(j < m_memory.GetSize());
   while (code_size < _num_bits) {
-    unsigned int inst_code = (unsigned int) GetInstSet().GetInstructionCode(m_memory[j]);
+    unsigned int inst_code = (unsigned int) GetInstSet().GetInstructionCode(static_cast<const cCPUMemory&>(m_memory)[j]);
     // shift bits in, one by one ... excuse the counter variable pun
     for (int code_on = 0; (code_size < _num_bits) && (code_on < m_world->GetConfig().INST_CODE_LENGTH.Get()); code_on++) {
       if (_dir < 0) {
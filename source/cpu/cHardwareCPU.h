@@ -30,6 +30,7 @@
 #include "cCPUMemory.h"
 #include "cCPUStack.h"
 #include "cHardwareBase.h"
+#include "cLabelIndex.h"
 #include "cString.h"
 #include "cStats.h"
 #include "tInstLib.h"
@@ -106,6 +107,7 @@ protected:
   const tMethod* m_functions;
 
   cCPUMemory m_memory;          // Memory...
+  cLabelIndex m_label_index;    // Nop runs of m_memory, for template searches
   cCPUStack m_global_stack;     // A stack that all threads share.
 
   Apto::Array<cLocalThread> m_threads;
@@ -127,6 +129,10 @@ protected:
 
     bool m_slip_read_head:1;
   };
+  
+  typedef bool (cHardwareCPU::*tSingleProcess)(cAvidaContext& ctx, bool speculative);
+  static const tSingleProcess s_single_process[SP_NUM_VARIANTS];
+  int m_sp_features;
 
   // <-- Promoter model
   int m_promoter_index;       //site to begin looking for the next active promoter from
@@ -153,6 +159,7 @@ protected:
   // Epigenetic State -->
 
 
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst);
   
   // --------  Stack Manipulation...  --------
@@ -173,8 +180,6 @@ protected:
   cCodeLabel& GetLabel() { return m_threads[m_cur_thread].next_label; }
   void ReadLabel(int max_size=cCodeLabel::MAX_LENGTH);
   cHeadCPU FindLabel(int direction);
-  int FindLabel_Forward(const cCodeLabel & search_label, const InstructionSequence& search_genome, int pos);
-  int FindLabel_Backward(const cCodeLabel & search_label, const InstructionSequence& search_genome, int pos);
   cHeadCPU FindLabel(const cCodeLabel & in_label, int direction);
   void FindLabelInMemory(const cCodeLabel& label, cHeadCPU& search_head);
 
@@ -243,6 +248,7 @@ public:
 
   bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
   void ProcessBonusInst(cAvidaContext& ctx, const Instruction& inst);
+  void Divide_CompleteDeferred(cAvidaContext& ctx);
 
 
   // --------  Helper methods  --------
@@ -36,6 +36,7 @@
 #include "cOrganism.h"
 #include "cPhenotype.h"
 #include "cPopulation.h"
+#include "cProfiler.h"
 #include "cStateGrid.h"
 #include "cStringUtil.h"
 #include "cWorld.h"
@@ -418,7 +419,7 @@ tInstLib<cHardwareExperimental::tMethod>* cHardwareExperimental::initInstLib(voi
 }
 
 cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world, cOrganism* in_organism, cInstSet* in_inst_set)
-: cHardwareBase(world, in_organism, in_inst_set), m_sensor(world, in_organism)
+: cHardwareBase(world, in_organism, in_inst_set), m_label_index(*in_inst_set), m_sensor(world, in_organism)
 {
   m_functions = s_inst_slib->GetFunctions();
   
@@ -433,6 +434,9 @@ cHardwareExperimental::cHardwareExperimental(cAvidaContext& ctx, cWorld* world,
     m_no_active_promoter_halt = (m_world->GetConfig().NO_ACTIVE_PROMOTER_EFFECT.Get() == 2);
   }
   
+  m_sp_features = ((m_has_any_costs) ? SP_COSTS : 0) | ((m_promoters_enabled) ? SP_PROMOTERS : 0) |
+                  ((m_promoters_enabled && m_constitutive_regulation) ? SP_REGULATION : 0);
+  
   m_slip_read_head = !m_world->GetConfig().SLIP_COPY_MODE.Get();
   
   const Genome& in_genome = in_organism->GetGenome();
@@ -472,8 +476,9 @@ void cHardwareExperimental::internalReset()
     
     m_promoters.Resize(0);
     
-    for (int i=0; i < m_memory.GetSize(); i++) {
-      if (m_inst_set->IsPromoter(m_memory[i])) {
+    const cCPUMemory& memory = m_memory;
+    for (int i=0; i < memory.GetSize(); i++) {
+      if (m_inst_set->IsPromoter(memory[i])) {
         int code = Numberate(i - 1, -1, m_world->GetConfig().PROMOTER_CODE_SIZE.Get());
         m_promoters.Push(cPromoter(i, code));
       }
@@ -544,6 +549,14 @@ void cHardwareExperimental::cLocalThread::Reset(cHardwareExperimental* in_hardwa
 // to be as optimized as possible.  This is the heart of avida.
 
 bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
+{
+  const int features = (m_tracer) ? (m_sp_features | SP_TRACE) : m_sp_features;
+  return (this->*s_single_process[features])(ctx, speculative);
+}
+
+// Each combination of SP_ features is a separate instantiation, so the feature tests below are resolved at compile
+// time and the common configuration (no costs, promoters, or tracing) runs without them.
+template <int FEATURES> bool cHardwareExperimental::singleProcess(cAvidaContext& ctx, bool speculative)
 {
   assert(!speculative || (speculative && !m_thread_slicing_parallel));
   
@@ -559,7 +572,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   cPhenotype& phenotype = m_organism->GetPhenotype();
   
   // First instruction - check whether we should be starting at a promoter, when enabled.
-  if (phenotype.GetCPUCyclesUsed() == 0 && m_promoters_enabled) PromoterTerminate(ctx);
+  if ((FEATURES & SP_PROMOTERS) && phenotype.GetCPUCyclesUsed() == 0) PromoterTerminate(ctx);
   
   m_cycle_count++;
   assert(m_cycle_count < 0x8000);
@@ -568,7 +581,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   
   // If we have threads turned on and we executed each thread in a single
   // timestep, adjust the number of instructions executed accordingly.
-  const int num_inst_exec = (m_world->GetConfig().THREAD_SLICING_METHOD.Get() == 1) ? m_threads.GetSize() : 1;
+  const int num_inst_exec = (m_thread_slicing_parallel) ? m_threads.GetSize() : 1;
   
   int num_active = 0;
   for (int i = 0; i < m_threads.GetSize(); i++) {
@@ -599,7 +612,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       <<  " cell: " << m_organism->GetOrgInterface().GetAVCellID() << endl; */
 
     // Print the status of this CPU at each step...
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this);
     
     // Find the instruction to be executed
     const Instruction cur_inst = ip.GetInst();
@@ -614,7 +627,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
     }
     
     // Print the short form status of this CPU at each step... 
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true);
     
     // Test if costs have been paid and it is okay to execute this now...
     bool exec = true;
@@ -622,13 +635,17 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
     
     // record any failure due to costs being paid
     // before we try to execute the instruction, is this org currently paying precosts for it
-    bool on_pause = IsPayingActiveCost(ctx, m_cur_thread);
-    if (m_has_any_costs) exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);    
+    // (only post costs put an org on pause, and those are counted among any costs)
+    bool on_pause = false;
+    if (FEATURES & SP_COSTS) {
+      on_pause = IsPayingActiveCost(ctx, m_cur_thread);
+      exec = SingleProcess_PayPreCosts(ctx, cur_inst, m_cur_thread);
+    }
     if (!exec) exec_success = -1;
 
-    if (m_promoters_enabled) {
+    if (FEATURES & SP_PROMOTERS) {
       // Constitutive regulation applied here
-      if (m_constitutive_regulation) Inst_SenseRegulate(ctx); 
+      if (FEATURES & SP_REGULATION) Inst_SenseRegulate(ctx);
       
       // If there are no active promoters and a certain mode is set, then don't execute any further instructions
       if (m_no_active_promoter_halt && m_promoter_index == -1) exec = false;
@@ -649,19 +666,21 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
       
       //Add to the promoter inst executed count before executing the inst (in case it is a terminator)
-      if (m_promoters_enabled) m_threads[m_cur_thread].IncPromoterInstExecuted();
+      if (FEATURES & SP_PROMOTERS) m_threads[m_cur_thread].IncPromoterInstExecuted();
       
       if (exec == true) {
         if (SingleProcess_ExecuteInst(ctx, cur_inst)) {
-          SingleProcess_PayPostResCosts(ctx, cur_inst); 
-          SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          if (FEATURES & SP_COSTS) {
+            SingleProcess_PayPostResCosts(ctx, cur_inst); 
+            SingleProcess_SetPostCPUCosts(ctx, cur_inst, m_cur_thread); 
+          }
           // record execution success
           exec_success = 1;
         }
       }
       // Check if the instruction just executed caused premature death, break out of execution if so
       if (phenotype.GetToDelete()) {
-        if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+        if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
         break;
       }
       
@@ -673,7 +692,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       phenotype.IncTimeUsed(addl_time_cost);
       
       // In the promoter model, we may force termination after a certain number of inst have been executed
-      if (m_promoters_enabled) {
+      if (FEATURES & SP_PROMOTERS) {
         const double processivity = m_world->GetConfig().PROMOTER_PROCESSIVITY.Get();
         if (ctx.GetRandom().P(1 - processivity)) PromoterTerminate(ctx);
         if (m_world->GetConfig().PROMOTER_INST_MAX.Get() &&
@@ -683,7 +702,7 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
       }
     }
     // if using mini traces, report success or failure of execution
-    if (m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
+    if ((FEATURES & SP_TRACE) && m_tracer) m_tracer->TraceHardware(ctx, *this, false, true, exec_success);
     
     bool do_record = false;
     // record exec failed if the org just now started paying precosts
@@ -719,6 +738,18 @@ bool cHardwareExperimental::SingleProcess(cAvidaContext& ctx, bool speculative)
   return !m_spec_die;
 }
 
+const cHardwareExperimental::tSingleProcess cHardwareExperimental::s_single_process[SP_NUM_VARIANTS] = {
+  &cHardwareExperimental::singleProcess<0x0>, &cHardwareExperimental::singleProcess<0x1>,
+  &cHardwareExperimental::singleProcess<0x2>, &cHardwareExperimental::singleProcess<0x3>,
+  &cHardwareExperimental::singleProcess<0x4>, &cHardwareExperimental::singleProcess<0x5>,
+  &cHardwareExperimental::singleProcess<0x6>, &cHardwareExperimental::singleProcess<0x7>,
+  &cHardwareExperimental::singleProcess<0x8>, &cHardwareExperimental::singleProcess<0x9>,
+  &cHardwareExperimental::singleProcess<0xA>, &cHardwareExperimental::singleProcess<0xB>,
+  &cHardwareExperimental::singleProcess<0xC>, &cHardwareExperimental::singleProcess<0xD>,
+  &cHardwareExperimental::singleProcess<0xE>, &cHardwareExperimental::singleProcess<0xF>
+};
+
+
 // This method will handle the actuall execution of an instruction
 // within single process, once that function has been finalized.
 bool cHardwareExperimental::SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst) 
@@ -740,9 +771,17 @@ bool cHardwareExperimental::SingleProcess_ExecuteInst(cAvidaContext& ctx, const
   // instruction execution count incremeneted
   m_organism->GetPhenotype().IncCurInstCount(actual_inst.GetOp());
   
-  // And execute it.
+  // And execute it, timing a sample of the instructions when profiling.
   m_from_sensor = false;
-  const bool exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  bool exec_success;
+  if (m_inst_profile && m_inst_profile->SampleNext()) {
+    const cInstProfile::Cycles start = cInstProfile::ReadCycles();
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+    m_inst_profile->AddSample(actual_inst.GetOp(), cInstProfile::ReadCycles() - start);
+  } else {
+    exec_success = (this->*(m_functions[inst_idx]))(ctx);
+  }
+  if (m_inst_profile && exec_success) m_inst_profile->CountInst(actual_inst.GetOp());
   
 	if (exec_success) {
     int code_len = m_world->GetConfig().INST_CODE_LENGTH.Get();
@@ -927,7 +966,7 @@ void cHardwareExperimental::PrintMiniTraceStatus(cAvidaContext& ctx, ostream& fp
 
   fp << next_name << " ";
   // any trailing nops (up to NUM_REGISTERS)
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = getIP().GetPosition();
   Apto::Array<int, Apto::Smart> seq;
   seq.Resize(0);
@@ -960,42 +999,22 @@ cHeadCPU cHardwareExperimental::FindLabelStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_memory;
-  int pos = 0;
-  
-  while (pos < memory.GetSize()) {
-    if (m_inst_set->IsLabel(memory[pos])) { // starting label found
-      pos++;
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos < memory.GetSize()) {
-        if (!m_inst_set->IsNop(memory[pos]) || search_label[size_matched] != m_inst_set->GetNopMod(memory[pos])) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        // Return Head pointed at last NOP of label sequence
-        if (mark_executed) {
-          size_matched++; // Increment size matched so that it includes the label instruction
-          const int start = pos - size_matched;
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
-        }
-        return cHeadCPU(this, pos - 1, ip.GetMemSpace());
-      }
-      
-      continue; 
-    }
-    pos++;
-  }
+  // Find the first 'label' instruction directly followed by the label pattern, can be substring of 'label'ed target
+  // - must match all NOPs in search_label
+  // - extra NOPs in 'label'ed target are ignored
+  m_label_index.Update(m_memory);
+  const int start = m_label_index.FindLabelStart(search_label);
   
   // Return start point if not found
-  return ip;
+  if (start < 0) return ip;
+  
+  // Return Head pointed at last NOP of label sequence
+  const int size_matched = search_label.GetSize() + 1; // includes the label instruction
+  if (mark_executed) {
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+    for (int i = 0; i < size_matched && i < max; i++) m_memory.SetFlagExecuted(start + i);
+  }
+  return cHeadCPU(this, start + size_matched - 1, ip.GetMemSpace());
 }
 
 cHeadCPU cHardwareExperimental::FindNopSequenceStart(bool mark_executed)
@@ -1006,7 +1025,7 @@ cHeadCPU cHardwareExperimental::FindNopSequenceStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = 0;
   
   while (pos < memory.GetSize()) {
@@ -1028,7 +1047,7 @@ cHeadCPU cHardwareExperimental::FindNopSequenceStart(bool mark_executed)
         if (mark_executed) {
           const int start = pos - size_matched;
           const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
+          for (int i = 0; i < size_matched && i < max; i++) m_memory.SetFlagExecuted(start + i);
         }
         return cHeadCPU(this, pos - 1, ip.GetMemSpace());
       }
@@ -1049,46 +1068,25 @@ cHeadCPU cHardwareExperimental::FindLabelForward(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cHeadCPU pos(ip);
-  pos++;
+  // Find the next 'label' instruction after the IP (wrapping around) that is directly followed by the label pattern
+  // - must match all NOPs in search_label
+  // - extra NOPs in 'label'ed target are ignored
+  m_label_index.Update(m_memory);
+  const int label_start = m_label_index.FindLabelForward(search_label, ip.GetPosition());
   
-  while (pos.GetPosition() != ip.GetPosition()) {
-    if (m_inst_set->IsLabel(pos.GetInst())) { // starting label found
-      const int label_start = pos.GetPosition();
-      pos++;
-      
-      // Check for direct matched label pattern, can be substring of 'label'ed target
-      // - must match all NOPs in search_label
-      // - extra NOPs in 'label'ed target are ignored
-      int size_matched = 0;
-      while (size_matched < search_label.GetSize() && pos.GetPosition() != ip.GetPosition()) {
-        if (!m_inst_set->IsNop(pos.GetInst()) || search_label[size_matched] != m_inst_set->GetNopMod(pos.GetInst())) break;
-        size_matched++;
-        pos++;
-      }
-      
-      // Check that the label matches and has examined the full sequence of nops following the 'label' instruction
-      if (size_matched == search_label.GetSize()) {
-        pos--;
-        const int found_pos = pos.GetPosition();
-        
-        if (mark_executed) {
-          pos.Set(label_start);
-          const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
-        }
-        
-        // Return Head pointed at last NOP of label sequence
-        return cHeadCPU(this, found_pos, ip.GetMemSpace());
-      }
-      
-      continue; 
-    }
-    pos++;
+  // Return start point if not found
+  if (label_start < 0) return ip;
+  
+  cHeadCPU pos(this, label_start, ip.GetMemSpace());
+  const int size_matched = search_label.GetSize();
+  if (mark_executed) {
+    const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
+    for (int i = 0; i < size_matched && i < max; i++, pos++) pos.SetFlagExecuted();
   }
   
-  // Return start point if not found
-  return ip;
+  // Return Head pointed at last NOP of label sequence
+  pos.Set(label_start + size_matched, ip.GetMemSpace());
+  return pos;
 }
 
 cHeadCPU cHardwareExperimental::FindLabelBackward(bool mark_executed)
@@ -1555,6 +1553,12 @@ bool cHardwareExperimental::Divide_Main(cAvidaContext& ctx, const int div_point,
   // Handle Divide Mutations...
   Divide_DoMutations(ctx, mut_multiplier);
   
+  // If the offspring test has been deferred, the rest of the divide is handled by Divide_CompleteDeferred()
+  if (Divide_DeferFitnessTest(ctx)) {
+    m_mal_active = false;
+    return true;
+  }
+  
   // Many tests will require us to run the offspring through a test CPU;
   // this is, for example, to see if mutations need to be reverted or if
   // lineages need to be updated.
@@ -1581,6 +1585,24 @@ bool cHardwareExperimental::Divide_Main(cAvidaContext& ctx, const int div_point,
   return true;
 }
 
+void cHardwareExperimental::Divide_CompleteDeferred(cAvidaContext& ctx)
+{
+  Divide_TestFitnessMeasures(ctx);
+  
+  // reset first time instruction costs
+  for (int i = 0; i < m_inst_ft_cost.GetSize(); i++) {
+    m_inst_ft_cost[i] = m_inst_set->GetFTCost(Instruction(i));
+  }
+  
+  // Activate the child
+  bool parent_alive = m_organism->ActivateDivide(ctx);
+  
+  // Do more work if the parent lives through the birth of the offspring
+  if (parent_alive) {
+    if (m_world->GetConfig().DIVIDE_METHOD.Get() == DIVIDE_METHOD_SPLIT) Reset(ctx);
+  }
+}
+
 void cHardwareExperimental::checkWaitingThreads(int cur_thread, int reg_num)
 {
   for (int i = 0; i < m_threads.GetSize(); i++) {
@@ -2827,7 +2849,7 @@ int cHardwareExperimental::Numberate(int _pos, int _dir, int _num_bits)
   assert(j < m_memory.GetSize());
   while (code_size < _num_bits)
   {
-    unsigned int inst_code = (unsigned int) GetInstSet().GetInstructionCode(m_memory[j]);
+    unsigned int inst_code = (unsigned int) GetInstSet().GetInstructionCode(static_cast<const cCPUMemory&>(m_memory)[j]);
     // shift bits in, one by one ... excuse the counter variable pun
     for (int code_on = 0; (code_size < _num_bits) && (code_on < m_world->GetConfig().INST_CODE_LENGTH.Get()); code_on++)
     {
@@ -3418,23 +3440,13 @@ bool cHardwareExperimental::Inst_RotateOrgID(cAvidaContext&)
   int max_dist = 0;
   const int long_axis = (int) (max(worldx, worldy) * 0.5 + 0.5);  
   m_world->GetConfig().LOOK_DIST.Get() != -1 ? max_dist = m_world->GetConfig().LOOK_DIST.Get() : max_dist = long_axis;
-  bool have_org2use = false;
   
   // return false if invalid number or self
   if (id_sought < 0 || id_sought == m_organism->GetID()) return false;
   
   // if valid number, does the value represent a living organism?
-  cOrganism* target_org  = NULL;
-  const Apto::Array<cOrganism*, Apto::Smart>& live_orgs = m_organism->GetOrgInterface().GetLiveOrgList();
-  for (int i = 0; i < live_orgs.GetSize(); i++) {  
-    cOrganism* org = live_orgs[i];
-    if (id_sought == org->GetID()) {
-      target_org = org;
-      have_org2use = true;
-      break;
-    }
-  }
-  if (!have_org2use) return false;
+  cOrganism* target_org = m_organism->GetOrgInterface().GetLiveOrgByID(id_sought);
+  if (!target_org) return false;
   else {
     int target_org_cell = target_org->GetOrgInterface().GetCellID();
     int searching_org_cell = m_organism->GetOrgInterface().GetCellID();
@@ -3511,23 +3523,13 @@ bool cHardwareExperimental::Inst_RotateAwayOrgID(cAvidaContext&)
   int max_dist = 0;
   const int long_axis = (int) (max(worldx, worldy) * 0.5 + 0.5);  
   m_world->GetConfig().LOOK_DIST.Get() != -1 ? max_dist = m_world->GetConfig().LOOK_DIST.Get() : max_dist = long_axis;
-  bool have_org2use = false;
   
   // return false if invalid number or self
   if (id_sought < 0 || id_sought == m_organism->GetID()) return false;
   
   // if valid number, does the value represent a living organism?
-  cOrganism* target_org = NULL;
-  const Apto::Array<cOrganism*, Apto::Smart>& live_orgs = m_organism->GetOrgInterface().GetLiveOrgList();
-  for (int i = 0; i < live_orgs.GetSize(); i++) {  
-    cOrganism* org = live_orgs[i];
-    if (id_sought == org->GetID()) {
-      target_org = org;
-      have_org2use = true;
-      break;
-    }
-  }
-  if (!have_org2use) return false;
+  cOrganism* target_org = m_organism->GetOrgInterface().GetLiveOrgByID(id_sought);
+  if (!target_org) return false;
   else {
     int target_org_cell = target_org->GetOrgInterface().GetCellID();
     int searching_org_cell = m_organism->GetOrgInterface().GetCellID();
@@ -5913,23 +5915,13 @@ bool cHardwareExperimental::Inst_AttackSpecPrey(cAvidaContext& ctx)
   if (m_use_avatar && m_use_avatar != 2) return false;
   const int id_sought_reg = FindModifiedRegister(rBX);
   const int id_sought = m_threads[m_cur_thread].reg[id_sought_reg].value;
-  bool have_org2use = false;
   
   // return false if invalid number or self
   if (id_sought < 0 || id_sought == m_organism->GetID()) return false;
   
   // if valid number, does the value represent a living organism?
-  cOrganism* target  = NULL;
-  const Apto::Array <cOrganism*, Apto::Smart> live_orgs = m_organism->GetOrgInterface().GetLiveOrgList();
-  for (int i = 0; i < live_orgs.GetSize(); i++) {
-    cOrganism* org = live_orgs[i];
-    if (id_sought == org->GetID()) {
-      target = org;
-      have_org2use = true;
-      break;
-    }
-  }
-  if (!have_org2use) return false;
+  cOrganism* target = m_organism->GetOrgInterface().GetLiveOrgByID(id_sought);
+  if (!target) return false;
 
   if (!m_use_avatar) { if (target != m_organism->GetOrgInterface().GetNeighbor())  return false; }
   else if (m_use_avatar == 2) { if (target->GetCellID() != m_organism->GetOrgInterface().GetAVFacedCellID())  return false; }
@@ -6774,7 +6766,7 @@ bool cHardwareExperimental::Inst_ModifyDisplay(cAvidaContext& ctx)
 {
   sOrgDisplay* this_display = m_organism->GetOrgDisplayData();
   if (this_display == NULL) return false;
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = getIP().GetPosition();
   bool message_used = false;
   for (int i = 0; i < 5; i++) {
@@ -6806,7 +6798,7 @@ bool cHardwareExperimental::Inst_ReadLastSeenDisplay(cAvidaContext& ctx)
 {
   if (!m_sensor.HasSeenDisplay()) return false;
   sOrgDisplay& last_seen = m_sensor.GetLastSeenDisplay();
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = getIP().GetPosition();
   bool message_read = false;
   for (int i = 0; i < 5; i++) {
@@ -6835,7 +6827,7 @@ bool cHardwareExperimental::Inst_ReadLastSeenDisplay(cAvidaContext& ctx)
 
 bool cHardwareExperimental::Inst_ModifySimpDisplay(cAvidaContext& ctx)
 {
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = getIP().GetPosition();
   bool message_used = false;
   for (int i = 0; i < 4; i++) {
@@ -6864,7 +6856,7 @@ bool cHardwareExperimental::Inst_ReadLastSimpDisplay(cAvidaContext& ctx)
 {
   if (!m_sensor.HasSeenDisplay()) return false;
   sOrgDisplay& last_seen = m_sensor.GetLastSeenDisplay();
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = getIP().GetPosition();
   bool message_read = false;
   for (int i = 0; i < 4; i++) {
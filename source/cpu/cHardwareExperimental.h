@@ -31,6 +31,7 @@
 #include "cEnvironment.h"
 #include "cHardwareBase.h"
 #include "cHeadCPU.h"
+#include "cLabelIndex.h"
 #include "cOrgSensor.h"
 #include "cStats.h"
 #include "cString.h"
@@ -186,6 +187,7 @@ private:
   const tMethod* m_functions;
   
   cCPUMemory m_memory;          // Memory...
+  cLabelIndex m_label_index;    // Label instruction sites of m_memory, for label searches
   Stack m_global_stack;     // A stack that all threads share.
   
   Apto::Array<cLocalThread, Apto::ManagedPointer> m_threads;
@@ -222,6 +224,10 @@ private:
     unsigned int m_waiting_threads:4;
   };
   
+  typedef bool (cHardwareExperimental::*tSingleProcess)(cAvidaContext& ctx, bool speculative);
+  static const tSingleProcess s_single_process[SP_NUM_VARIANTS];
+  int m_sp_features;
+  
   
   // Promoter model
   int m_promoter_index;       // site to begin looking for the next active promoter from
@@ -244,6 +250,7 @@ public:
   // --------  Core Execution Methods  --------
   bool SingleProcess(cAvidaContext& ctx, bool speculative = false);
   void ProcessBonusInst(cAvidaContext& ctx, const Instruction& inst);
+  void Divide_CompleteDeferred(cAvidaContext& ctx);
 
   
   // --------  Helper Methods  --------
@@ -303,6 +310,7 @@ public:
 private:
   
   // --------  Core Execution Methods  --------
+  template <int FEATURES> bool singleProcess(cAvidaContext& ctx, bool speculative);
   bool SingleProcess_ExecuteInst(cAvidaContext& ctx, const Instruction& cur_inst);
   void internalReset();
   void internalResetOnFailedDivide();
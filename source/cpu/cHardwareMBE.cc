@@ -759,7 +759,7 @@ void cHardwareMBE::PrintMiniTraceStatus(cAvidaContext& ctx, ostream& fp)
   cString next_name(GetInstSet().GetName(IP().GetInst()));
   fp << next_name << " ";
   // any trailing nops (up to NUM_REGISTERS)
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = getIP().GetPosition();
   Apto::Array<int, Apto::Smart> seq;
   seq.Resize(0);
@@ -792,7 +792,7 @@ cHeadCPU cHardwareMBE::FindLabelStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = 0;
   
   while (pos < memory.GetSize()) {
@@ -816,7 +816,7 @@ cHeadCPU cHardwareMBE::FindLabelStart(bool mark_executed)
           size_matched++; // Increment size matched so that it includes the label instruction
           const int start = pos - size_matched;
           const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get() + 1; // Max label + 1 for the label instruction itself
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
+          for (int i = 0; i < size_matched && i < max; i++) m_memory.SetFlagExecuted(start + i);
         }
         return cHeadCPU(this, pos - 1, ip.GetMemSpace());
       }
@@ -838,7 +838,7 @@ cHeadCPU cHardwareMBE::FindNopSequenceStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_memory;
+  const cCPUMemory& memory = m_memory;
   int pos = 0;
   
   while (pos < memory.GetSize()) {
@@ -860,7 +860,7 @@ cHeadCPU cHardwareMBE::FindNopSequenceStart(bool mark_executed)
         if (mark_executed) {
           const int start = pos - size_matched;
           const int max = m_world->GetConfig().MAX_LABEL_EXE_SIZE.Get();
-          for (int i = 0; i < size_matched && i < max; i++) memory.SetFlagExecuted(start + i);
+          for (int i = 0; i < size_matched && i < max; i++) m_memory.SetFlagExecuted(start + i);
         }
         return cHeadCPU(this, pos - 1, ip.GetMemSpace());
       }
@@ -908,7 +908,7 @@ void cHardwareMGE::PrintMiniTraceStatus(cAvidaContext& ctx, ostream& fp)
   cString next_name(GetInstSet().GetName(IP().GetInst()));
   fp << next_name << " ";
   // any trailing nops (up to NUM_REGISTERS)
-  cCPUMemory& memory = main_memory;
+  const cCPUMemory& memory = main_memory;
   int pos = getIP().GetPosition();
   Apto::Array<int, Apto::Smart> seq;
   seq.Resize(0);
@@ -941,7 +941,7 @@ cHeadCPU cHardwareMGE::FindLabelStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_threads[m_cur_thread].thread_mem;
+  const cCPUMemory& memory = m_threads[m_cur_thread].thread_mem;
   int pos = 0;
   
   while (pos < memory.GetSize()) {
@@ -988,7 +988,7 @@ int cHardwareMGE::FindNopSequenceOrgStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return m_cur_thread;
   
-  cCPUMemory& memory = main_memory;
+  const cCPUMemory& memory = main_memory;
   int pos = 0;
   
   while (pos < memory.GetSize()) {
@@ -1033,7 +1033,7 @@ cHeadCPU cHardwareMGE::FindNopSequenceStart(bool mark_executed)
   // Make sure the label is of size > 0.
   if (search_label.GetSize() == 0) return ip;
   
-  cCPUMemory& memory = m_threads[m_cur_thread].thread_mem;
+  const cCPUMemory& memory = m_threads[m_cur_thread].thread_mem;
   int pos = 0;
   
   while (pos < memory.GetSize()) {
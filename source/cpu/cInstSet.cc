@@ -44,6 +44,7 @@ cInstSet::cInstSet(const cInstSet& _in)
   , m_inst_lib(_in.m_inst_lib)
   , m_lib_name_map(_in.m_lib_name_map)
   , m_mutation_index(NULL)
+  , m_mutation_sampler(NULL)
   , m_has_costs(_in.m_has_costs)
   , m_has_ft_costs(_in.m_has_ft_costs)
   , m_has_energy_costs(_in.m_has_energy_costs)
@@ -53,7 +54,8 @@ cInstSet::cInstSet(const cInstSet& _in)
   , m_has_choosy_female_costs(_in.m_has_choosy_female_costs)
   , m_has_post_costs(_in.m_has_post_costs)
 {
-  m_mutation_index = new cOrderedWeightedIndex(*_in.m_mutation_index);
+  if (_in.m_mutation_index) m_mutation_index = new cOrderedWeightedIndex(*_in.m_mutation_index);
+  if (_in.m_mutation_sampler) m_mutation_sampler = new cAliasSampler(*_in.m_mutation_sampler);
 }
 
 cInstSet& cInstSet::operator=(const cInstSet& _in)
@@ -63,7 +65,6 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
   m_hw_type = _in.m_hw_type;
   m_inst_lib = _in.m_inst_lib;
   m_lib_name_map = _in.m_lib_name_map;
-  m_mutation_index = NULL;
   m_has_costs = _in.m_has_costs;
   m_has_ft_costs = _in.m_has_ft_costs;
   m_has_energy_costs = _in.m_has_energy_costs;
@@ -73,19 +74,39 @@ cInstSet& cInstSet::operator=(const cInstSet& _in)
   m_has_choosy_female_costs = _in.m_has_choosy_female_costs;
   m_has_post_costs = _in.m_has_post_costs;
 
-  m_mutation_index = new cOrderedWeightedIndex(*_in.m_mutation_index);
+  cOrderedWeightedIndex* index = (_in.m_mutation_index) ? new cOrderedWeightedIndex(*_in.m_mutation_index) : NULL;
+  cAliasSampler* sampler = (_in.m_mutation_sampler) ? new cAliasSampler(*_in.m_mutation_sampler) : NULL;
+  delete m_mutation_index;
+  delete m_mutation_sampler;
+  m_mutation_index = index;
+  m_mutation_sampler = sampler;
   return *this;
 }
 
 
 Instruction cInstSet::GetRandomInst(cAvidaContext& ctx) const
 {
+  if (m_mutation_sampler) return Instruction(m_mutation_sampler->Sample(ctx.GetRandom()));
+  
   double weight = ctx.GetRandom().GetDouble(m_mutation_index->GetTotalWeight());
   unsigned inst_ndx = m_mutation_index->FindPosition(weight);
   return Instruction(inst_ndx);
 }
 
 
+// The sampler is rebuilt right away, rather than on the next sample, since instruction sets are shared across threads
+void cInstSet::SetRedundancy(const Instruction& inst, int _redundancy)
+{
+  m_lib_name_map[inst.GetOp()].redundancy = _redundancy;
+  if (m_mutation_sampler) {
+    m_mutation_sampler->SetWeight(inst.GetOp(), _redundancy);
+    m_mutation_sampler->Rebuild();
+  } else {
+    m_mutation_index->SetWeight(inst.GetOp(), _redundancy);
+  }
+}
+
+
 
 Instruction cInstSet::ActivateNullInst()
 {  
@@ -293,15 +314,23 @@ bool cInstSet::LoadWithStringList(const cStringList& sl, cUserFeedback* feedback
   }
 
   //Setup mutation indexing based on redundancies
-  m_mutation_index = new cOrderedWeightedIndex();
-  for (int id=0; id < m_lib_name_map.GetSize(); id++)
-  {
-     double red = m_lib_name_map[id].redundancy;
-     if (red == 0.0)
-     {
-       continue;
-     }
-     m_mutation_index->SetWeight(id, m_lib_name_map[id].redundancy);
+  delete m_mutation_index; m_mutation_index = NULL;
+  delete m_mutation_sampler; m_mutation_sampler = NULL;
+  if (m_world->GetConfig().MUTATION_INST_SAMPLER.Get() == 1) {
+    m_mutation_sampler = new cAliasSampler(m_lib_name_map.GetSize());
+    for (int id = 0; id < m_lib_name_map.GetSize(); id++) m_mutation_sampler->SetWeight(id, m_lib_name_map[id].redundancy);
+    m_mutation_sampler->Rebuild();
+  } else {
+    m_mutation_index = new cOrderedWeightedIndex();
+    for (int id=0; id < m_lib_name_map.GetSize(); id++)
+    {
+       double red = m_lib_name_map[id].redundancy;
+       if (red == 0.0)
+       {
+         continue;
+       }
+       m_mutation_index->SetWeight(id, m_lib_name_map[id].redundancy);
+    }
   }
   return success;
 }
@@ -23,12 +23,14 @@
 #ifndef cInstSet_h
 #define cInstSet_h
 
+#include <fstream>
 #include <iostream>
 
 #include "avida/core/InstructionSequence.h"
 
 #include "cString.h"
 #include "cInstLib.h"
+#include "cAliasSampler.h"
 #include "cOrderedWeightedIndex.h"
 
 using namespace std;
@@ -77,6 +79,7 @@ public:
   Apto::Array<int> m_lib_nopmod_map;
   
   cOrderedWeightedIndex* m_mutation_index;     // Weighted index for instructions 
+  cAliasSampler* m_mutation_sampler;           // Replaces the index when MUTATION_INST_SAMPLER is set
   
   bool m_has_costs;
   bool m_has_ft_costs;
@@ -94,13 +97,13 @@ public:
 
 public:
   inline cInstSet(cWorld* world, const cString& name, int hw_type, cInstLib* inst_lib, int stack_size, int uops_per_cycle)
-    : m_world(world), m_name(name), m_hw_type(hw_type), m_inst_lib(inst_lib), m_mutation_index(NULL)
+    : m_world(world), m_name(name), m_hw_type(hw_type), m_inst_lib(inst_lib), m_mutation_index(NULL), m_mutation_sampler(NULL)
     , m_has_costs(false), m_has_ft_costs(false), m_has_energy_costs(false), m_has_res_costs(false), m_has_fem_res_costs(false)
     , m_has_female_costs(false), m_has_choosy_female_costs(false), m_has_post_costs(false), m_stack_size(stack_size)
     , m_uops_per_cycle(uops_per_cycle) { ; }
   cInstSet(const cInstSet&); 
   cInstSet& operator=(const cInstSet&); 
-  inline ~cInstSet() { if (m_mutation_index != NULL) delete m_mutation_index; }
+  inline ~cInstSet() { delete m_mutation_index; delete m_mutation_sampler; }
   
   const cString& GetInstSetName() const { return m_name; }
   int GetHardwareType() const { return m_hw_type; }
@@ -164,7 +167,7 @@ public:
   
   // Modification of instructions during run.
   void SetProbFail(const Instruction& inst, double _prob_fail) { m_lib_name_map[inst.GetOp()].prob_fail = _prob_fail; }
-  void SetRedundancy(const Instruction& inst, int _redundancy) { m_lib_name_map[inst.GetOp()].redundancy = _redundancy; m_mutation_index->SetWeight(inst.GetOp(), _redundancy);}
+  void SetRedundancy(const Instruction& inst, int _redundancy);
 
   // accessors for instruction library
   cInstLib* GetInstLib() { return m_inst_lib; }
@@ -0,0 +1,229 @@
+/*
+ *  cLabelIndex.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cLabelIndex.h"
+
+#include "cCodeLabel.h"
+#include "cCPUMemory.h"
+#include "cInstSet.h"
+
+#include <cassert>
+
+
+void cLabelIndex::Update(cCPUMemory& memory)
+{
+  const int size = memory.GetSize();
+  bool runs_changed = (size != m_mods.GetSize());
+  bool labels_changed = runs_changed;
+
+  if (runs_changed) {
+    m_mods.Resize(size);
+    m_is_label.Resize(size);
+  }
+
+  const cCPUMemory& const_memory = memory;
+  const int end = memory.GetModifiedEnd();
+  for (int i = memory.GetModifiedBegin(); i < end; i++) {
+    const Avida::Instruction& inst = const_memory[i];
+    const int mod = (m_inst_set.IsNop(inst)) ? m_inst_set.GetNopMod(inst) : -1;
+    const bool is_label = m_inst_set.IsLabel(inst);
+
+    if ((mod < 0) != (m_mods[i] < 0)) runs_changed = true;
+    if (is_label != m_is_label[i]) labels_changed = true;
+    m_mods[i] = mod;
+    m_is_label[i] = is_label;
+  }
+  memory.ClearModified();
+
+  if (runs_changed) rebuildRuns();
+  if (labels_changed) rebuildLabelSites();
+}
+
+
+void cLabelIndex::rebuildRuns()
+{
+  m_run_start.Resize(0);
+  m_run_end.Resize(0);
+
+  const int size = m_mods.GetSize();
+  int pos = 0;
+  while (pos < size) {
+    if (m_mods[pos] < 0) {
+      pos++;
+      continue;
+    }
+    m_run_start.Push(pos);
+    while (pos < size && m_mods[pos] >= 0) pos++;
+    m_run_end.Push(pos);
+  }
+}
+
+
+void cLabelIndex::rebuildLabelSites()
+{
+  m_label_sites.Resize(0);
+  for (int i = 0; i < m_is_label.GetSize(); i++) if (m_is_label[i]) m_label_sites.Push(i);
+}
+
+
+// Returns the first offset in [begin, end) at which the full label matches, or -1
+int cLabelIndex::findWithin(const cCodeLabel& label, int begin, int end) const
+{
+  const int label_size = label.GetSize();
+  for (int offset = begin; offset <= end - label_size; offset++) {
+    int matches = 0;
+    while (matches < label_size && label[matches] == m_mods[offset + matches]) matches++;
+    if (matches == label_size) return offset;
+  }
+  return -1;
+}
+
+
+// The template search hops through memory label_size sites at a time.  Whenever it lands on a nop it examines
+// the whole nop run it landed in (clipped at search_start) and then resumes label_size sites past the end of the run.
+// Walking the run list visits exactly the runs that would be landed on, without touching the sites in between.
+
+int cLabelIndex::FindForward(const cCodeLabel& label, int search_start) const
+{
+  assert(search_start >= 0 && search_start < m_mods.GetSize());
+
+  const int label_size = label.GetSize();
+  int pos = search_start + label_size;
+
+  // Locate the first run that ends after pos
+  int lo = 0;
+  int hi = m_run_end.GetSize();
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_run_end[mid] <= pos) lo = mid + 1;
+    else hi = mid;
+  }
+
+  for (int run = lo; run < m_run_end.GetSize(); run++) {
+    const int run_start = m_run_start[run];
+    const int run_end = m_run_end[run];
+
+    // Advance to the first hop that reaches this run
+    if (pos < run_start) pos += ((run_start - pos + label_size - 1) / label_size) * label_size;
+    if (pos >= run_end) continue;
+
+    const int offset = findWithin(label, (run_start > search_start) ? run_start : search_start, run_end);
+    if (offset >= 0) return offset + label_size;
+
+    pos = run_end + label_size;
+  }
+
+  return -1;
+}
+
+
+int cLabelIndex::FindBackward(const cCodeLabel& label, int search_start) const
+{
+  assert(search_start < m_mods.GetSize());
+
+  const int label_size = label.GetSize();
+  int pos = search_start - label_size;
+  if (pos < 0) return -1;
+
+  // Locate the last run that starts at or before pos
+  int lo = 0;
+  int hi = m_run_start.GetSize();
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (m_run_start[mid] <= pos) lo = mid + 1;
+    else hi = mid;
+  }
+
+  for (int run = lo - 1; run >= 0 && pos >= 0; run--) {
+    const int run_start = m_run_start[run];
+    const int run_end = m_run_end[run];
+
+    // Retreat to the first hop that reaches this run
+    if (pos >= run_end) pos -= ((pos - run_end + label_size) / label_size) * label_size;
+    if (pos < run_start) continue;
+
+    const int clipped_end = (run_end < search_start) ? run_end : search_start;
+    if (findWithin(label, run_start, clipped_end) >= 0) return clipped_end;
+
+    pos = run_start - 1 - label_size;
+  }
+
+  return -1;
+}
+
+
+// Each label instruction is tested in memory order, except that sites consumed by a failed match attempt are not
+// retested (a failed attempt resumes at the site that broke the match).
+
+int cLabelIndex::FindLabelStart(const cCodeLabel& label) const
+{
+  const int label_size = label.GetSize();
+  const int size = m_mods.GetSize();
+
+  int scan_pos = 0;
+  for (int i = 0; i < m_label_sites.GetSize(); i++) {
+    const int site = m_label_sites[i];
+    if (site < scan_pos) continue;
+
+    int pos = site + 1;
+    int matched = 0;
+    while (matched < label_size && pos < size && label[matched] == m_mods[pos]) {
+      matched++;
+      pos++;
+    }
+    if (matched == label_size) return site;
+
+    scan_pos = pos;
+  }
+
+  return -1;
+}
+
+
+int cLabelIndex::FindLabelForward(const cCodeLabel& label, int ip) const
+{
+  const int label_size = label.GetSize();
+  const int size = m_mods.GetSize();
+  const int num_sites = m_label_sites.GetSize();
+
+  // Label sites after ip are visited first, then those before ip, all measured as distance past ip
+  int first = 0;
+  while (first < num_sites && m_label_sites[first] <= ip) first++;
+
+  int scan_dist = 1;
+  for (int i = 0; i < num_sites; i++) {
+    const int site = m_label_sites[(first + i) % num_sites];
+    const int dist = (site > ip) ? (site - ip) : (site - ip + size);
+    if (dist >= size || dist < scan_dist) continue;
+
+    int pos_dist = dist + 1;
+    int matched = 0;
+    while (matched < label_size && pos_dist < size && label[matched] == m_mods[(ip + pos_dist) % size]) {
+      matched++;
+      pos_dist++;
+    }
+    if (matched == label_size) return site;
+
+    scan_dist = pos_dist;
+  }
+
+  return -1;
+}
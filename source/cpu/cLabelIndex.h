@@ -0,0 +1,84 @@
+/*
+ *  cLabelIndex.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cLabelIndex_h
+#define cLabelIndex_h
+
+#include "apto/core/Array.h"
+
+class cCodeLabel;
+class cCPUMemory;
+class cInstSet;
+
+
+// cLabelIndex - Cached nop runs and label instruction sites of a single memory, used to speed up template searches
+// --------------------------------------------------------------------------------------------------------------
+//
+//  The index is refreshed by Update(), which only reexamines the sites that the memory reports as modified since the
+//  previous update.  Each index must be the only consumer of the modified range of the memory it follows.
+
+class cLabelIndex
+{
+private:
+  const cInstSet& m_inst_set;
+
+  Apto::Array<int, Apto::Smart> m_mods;         // nop modifier of each site, -1 if the site is not a nop
+  Apto::Array<bool, Apto::Smart> m_is_label;    // whether each site holds a label instruction
+
+  Apto::Array<int, Apto::Smart> m_run_start;    // maximal runs of nops, in memory order
+  Apto::Array<int, Apto::Smart> m_run_end;
+  Apto::Array<int, Apto::Smart> m_label_sites;  // sites of label instructions, in memory order
+
+
+  cLabelIndex(); // @not_implemented
+  cLabelIndex(const cLabelIndex&); // @not_implemented
+  cLabelIndex& operator=(const cLabelIndex&); // @not_implemented
+
+public:
+  cLabelIndex(const cInstSet& inst_set) : m_inst_set(inst_set) { ; }
+
+  void Update(cCPUMemory& memory);
+
+
+  // Template search (cHardwareCPU semantics) - the complement may be found inside of a longer nop sequence
+
+  // Search forward from after search_start, returns the site following the match, or -1 if not found
+  int FindForward(const cCodeLabel& label, int search_start) const;
+
+  // Search backward from before search_start, returns the site following the match, or -1 if not found
+  int FindBackward(const cCodeLabel& label, int search_start) const;
+
+
+  // Label instruction search (cHardwareExperimental semantics) - label must directly follow a label instruction
+
+  // Search from the beginning of memory, returns the site of the label instruction, or -1 if not found
+  int FindLabelStart(const cCodeLabel& label) const;
+
+  // Search circularly from after ip back around to ip, returns the site of the label instruction, or -1
+  int FindLabelForward(const cCodeLabel& label, int ip) const;
+
+private:
+  int findWithin(const cCodeLabel& label, int begin, int end) const;
+  void rebuildRuns();
+  void rebuildLabelSites();
+};
+
+#endif
@@ -0,0 +1,146 @@
+/*
+ *  cTestCPUBatch.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cTestCPUBatch.h"
+
+#include "apto/rng.h"
+
+#include "cAnalyzeJobQueue.h"
+#include "cAvidaContext.h"
+#include "cHardwareManager.h"
+#include "cTestCPU.h"
+#include "cWorld.h"
+#include "tAnalyzeJobBatch.h"
+
+
+// Number of runs queued per worker thread, so that threads finishing early can pick up the slack
+static const int RUNS_PER_WORKER = 4;
+
+
+class cTestCPUBatch::cRun
+{
+private:
+  cTestCPUBatch* m_batch;
+  int m_begin;
+  int m_end;
+
+public:
+  cRun(cTestCPUBatch* batch, int begin, int end) : m_batch(batch), m_begin(begin), m_end(end) { ; }
+
+  void Run(cAvidaContext& ctx) { m_batch->testRange(ctx, m_begin, m_end); }
+};
+
+
+cTestCPUBatch::cTestCPUBatch(cWorld* world, const cCPUTestInfo& settings)
+  : m_world(world), m_parallel(world->GetConfig().PARALLEL_TEST_BATCHES.Get()), m_settings(settings.GetGenerationTests())
+{
+  m_settings.CopySettings(settings);
+}
+
+cTestCPUBatch::~cTestCPUBatch()
+{
+  Clear();
+}
+
+
+int cTestCPUBatch::AddGenome(const Genome& genome)
+{
+  return AddGenome(genome, -1);
+}
+
+int cTestCPUBatch::AddGenome(const Genome& genome, int seed)
+{
+  m_genomes.Push(genome);
+  m_seeds.Push(seed);
+  m_results.Push(NULL);
+  return m_genomes.GetSize() - 1;
+}
+
+
+void cTestCPUBatch::Run(cAvidaContext& ctx)
+{
+  const int num_genomes = m_genomes.GetSize();
+
+  for (int i = 0; i < num_genomes; i++) {
+    if (m_results[i] == NULL) {
+      m_results[i] = new cCPUTestInfo(m_settings.GetGenerationTests());
+      m_results[i]->CopySettings(m_settings);
+    }
+  }
+
+  // Unless PARALLEL_TEST_BATCHES is set, the tests draw on the caller's random stream in order, just as testing each
+  // genome in turn with ctx would
+  if (!m_parallel) {
+    cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+    for (int i = 0; i < num_genomes; i++) testcpu->TestGenome(ctx, *m_results[i], m_genomes[i]);
+    delete testcpu;
+    return;
+  }
+
+  // Missing seeds are handed out in input order, before any test is run
+  for (int i = 0; i < num_genomes; i++) {
+    if (m_seeds[i] < 0) m_seeds[i] = ctx.GetRandom().GetInt(ctx.GetRandom().MaxSeed());
+  }
+
+  cAnalyzeJobQueue& jobqueue = m_world->GetJobQueue();
+  int num_runs = jobqueue.GetNumWorkers() * RUNS_PER_WORKER;
+  if (num_runs > num_genomes) num_runs = num_genomes;
+  if (m_settings.GetTracer()) num_runs = 1;
+
+  if (num_runs <= 1) {
+    testRange(ctx, 0, num_genomes);
+    return;
+  }
+
+  Apto::Array<cRun*> runs(num_runs);
+  tAnalyzeJobBatch<cRun> jobbatch(jobqueue);
+  for (int i = 0; i < num_runs; i++) {
+    runs[i] = new cRun(this, (num_genomes * i) / num_runs, (num_genomes * (i + 1)) / num_runs);
+    jobbatch.AddJob(runs[i], &cRun::Run);
+  }
+  jobbatch.RunBatch();
+
+  for (int i = 0; i < num_runs; i++) delete runs[i];
+}
+
+
+void cTestCPUBatch::Clear()
+{
+  for (int i = 0; i < m_results.GetSize(); i++) delete m_results[i];
+  m_genomes.Resize(0);
+  m_seeds.Resize(0);
+  m_results.Resize(0);
+}
+
+
+void cTestCPUBatch::testRange(cAvidaContext& ctx, int begin, int end)
+{
+  Apto::RNG::AvidaRNG rng;
+  cAvidaContext test_ctx(&ctx.Driver(), rng);
+  if (ctx.GetAnalyzeMode()) test_ctx.SetAnalyzeMode();
+
+  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(test_ctx);
+  for (int i = begin; i < end; i++) {
+    rng.ResetSeed(m_seeds[i]);
+    testcpu->TestGenome(test_ctx, *m_results[i], m_genomes[i]);
+  }
+  delete testcpu;
+}
@@ -0,0 +1,91 @@
+/*
+ *  cTestCPUBatch.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cTestCPUBatch_h
+#define cTestCPUBatch_h
+
+#include "avida/core/Genome.h"
+
+#include "cCPUTestInfo.h"
+
+#include <cassert>
+
+class cAvidaContext;
+class cWorld;
+
+using namespace Avida;
+
+
+// cTestCPUBatch - Tests a list of genomes across the analyze job queue, keeping the results in the order added
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Every genome is tested with a copy of the settings test info.  By default the genomes are tested in the order they
+//  were added, on the calling thread, drawing on the random stream of the context passed to Run(), which gives the
+//  same results as testing them one at a time.  With PARALLEL_TEST_BATCHES set, the genomes are split into contiguous
+//  runs, each of which is tested by a single job on one reused test CPU.  The random stream of each test is then
+//  seeded either by the caller, or from the context passed to Run() in the order the genomes were added, so the
+//  results do not depend on the number of threads.  Tests that trace execution are always run on the calling thread.
+
+class cTestCPUBatch
+{
+private:
+  class cRun;
+
+  cWorld* m_world;
+  bool m_parallel;
+  cCPUTestInfo m_settings;
+
+  Apto::Array<Genome> m_genomes;
+  Apto::Array<int> m_seeds;
+  Apto::Array<cCPUTestInfo*> m_results;
+
+
+  cTestCPUBatch(); // @not_implemented
+  cTestCPUBatch(const cTestCPUBatch&); // @not_implemented
+  cTestCPUBatch& operator=(const cTestCPUBatch&); // @not_implemented
+
+public:
+  cTestCPUBatch(cWorld* world, const cCPUTestInfo& settings);
+  ~cTestCPUBatch();
+
+  int GetSize() const { return m_genomes.GetSize(); }
+  
+  // Whether tests run on their own seeded random streams, rather than in order on the caller's stream
+  bool IsParallel() const { return m_parallel; }
+
+  // Queues a genome for testing, returning the index of its result.  Seeds only apply to parallel batches.
+  int AddGenome(const Genome& genome);
+  int AddGenome(const Genome& genome, int seed);
+
+  // Tests all queued genomes, blocking until every result is available
+  void Run(cAvidaContext& ctx);
+
+  // Releases all genomes and results, the settings are kept
+  void Clear();
+
+  const Genome& GetGenome(int idx) const { return m_genomes[idx]; }
+  cCPUTestInfo& GetResult(int idx) { assert(m_results[idx] != NULL); return *m_results[idx]; }
+
+private:
+  void testRange(cAvidaContext& ctx, int begin, int end);
+};
+
+#endif
@@ -50,6 +50,7 @@ public:
 
   
   const Apto::Array<cOrganism*, Apto::Smart>& GetLiveOrgList() const;
+  cOrganism* GetLiveOrgByID(int) const { return NULL; }
   cPopulationCell* GetCell() { return NULL; }
 	cPopulationCell* GetCell(int) { return NULL; }
   int GetCellID() { return -1; }
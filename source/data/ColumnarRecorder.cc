@@ -0,0 +1,497 @@
+/*
+ *  data/ColumnarRecorder.cc
+ *  avida-core
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/data/ColumnarRecorder.h"
+
+#include "avida/data/Package.h"
+
+#include <cstring>
+
+#ifdef AVD_HAVE_ZLIB
+# include <zlib.h>
+#endif
+
+
+namespace {
+  const char COLUMNAR_MAGIC[8] = { 'A', 'V', 'D', 'C', 'O', 'L', '0', '2' };
+  const unsigned int COLUMNAR_BYTE_ORDER = 0x01020304;
+
+  template <typename T> inline void appendValue(std::string& buf, T value)
+  {
+    buf.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  inline void appendString(std::string& buf, const Apto::String& str)
+  {
+    appendValue<unsigned int>(buf, str.GetSize());
+    buf.append((const char*)str, str.GetSize());
+  }
+
+  template <typename T> inline bool readValue(std::istream& in, T& value)
+  {
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return in.good();
+  }
+
+  template <typename T> inline bool extractValue(const std::string& buf, size_t& offset, T& value)
+  {
+    if (offset + sizeof(T) > buf.size()) return false;
+    memcpy(&value, buf.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+  }
+
+  inline Avida::Data::ColumnType packageColumnType(const Avida::Data::Package* value)
+  {
+    using namespace Avida::Data;
+    if (value && !value->IsAggregate()) {
+      if (dynamic_cast<const Wrap<int>*>(value) || dynamic_cast<const Wrap<bool>*>(value)) {
+        return COLUMN_INT;
+      } else if (dynamic_cast<const Wrap<long>*>(value)) {
+        return COLUMN_INT64;
+      } else if (dynamic_cast<const Wrap<unsigned int>*>(value)) {
+        return COLUMN_UINT64;
+      } else if (dynamic_cast<const Wrap<double>*>(value) || dynamic_cast<const Wrap<float>*>(value)) {
+        return COLUMN_DOUBLE;
+      }
+    }
+    return COLUMN_STRING;
+  }
+
+  // Full width values of the packages typed as COLUMN_INT64 and COLUMN_UINT64 by packageColumnType()
+  inline long long packageInt64Value(const Avida::Data::Package* value)
+  {
+    const Avida::Data::Wrap<long>* wrapped = dynamic_cast<const Avida::Data::Wrap<long>*>(value);
+    if (wrapped) return wrapped->Value();
+    return (value) ? value->IntValue() : 0;
+  }
+
+  inline unsigned long long packageUInt64Value(const Avida::Data::Package* value)
+  {
+    const Avida::Data::Wrap<unsigned int>* wrapped = dynamic_cast<const Avida::Data::Wrap<unsigned int>*>(value);
+    if (wrapped) return wrapped->Value();
+    return (value) ? value->IntValue() : 0;
+  }
+
+  inline bool extractString(const std::string& buf, size_t& offset, Apto::String& str)
+  {
+    unsigned int len = 0;
+    if (!extractValue(buf, offset, len) || offset + len > buf.size()) return false;
+    str = std::string(buf.data() + offset, len).c_str();
+    offset += len;
+    return true;
+  }
+}
+
+
+Avida::Data::ColumnarRecorder::ColumnarRecorder(const Apto::String& path, const Apto::Array<DataID>& data_ids,
+                                                Update interval, int block_rows, bool compress)
+  : m_fp((const char*)path, std::ios::out | std::ios::binary)
+  , m_columns(data_ids.GetSize())
+  , m_interval((interval > 0) ? interval : 1)
+  , m_first_update(-1)
+  , m_block_rows((block_rows > 0) ? block_rows : 1)
+  , m_compress(compress && CompressionAvailable())
+  , m_types_written(false)
+  , m_layout(data_ids)
+{
+  DataSetPtr ds(new DataSet);
+  for (int i = 0; i < data_ids.GetSize(); i++) {
+    ds->Insert(data_ids[i]);
+    m_columns[i].data_id = data_ids[i];
+    m_columns[i].type = COLUMN_UNTYPED;
+  }
+  m_requested = ds;
+  
+  // Write the header right away, so that a run that records no rows still leaves a readable file
+  if (m_fp.good()) writeHeader();
+}
+
+Avida::Data::ColumnarRecorder::~ColumnarRecorder()
+{
+  Flush();
+}
+
+
+void Avida::Data::ColumnarRecorder::NotifyData(Update current_update, DataRetrievalFunctor retrieve_data)
+{
+  if (!recordsUpdate(current_update)) return;
+
+  Apto::Array<PackagePtr> row(m_columns.GetSize());
+  for (int i = 0; i < m_columns.GetSize(); i++) row[i] = retrieve_data(m_columns[i].data_id);
+
+  if (!m_types_written) {
+    for (int i = 0; i < m_columns.GetSize(); i++) m_columns[i].type = packageColumnType(Apto::GetInternalPtr(row[i]));
+    writeTypes();
+  }
+
+  m_updates.Push(current_update);
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    Column& col = m_columns[i];
+    const PackagePtr& value = row[i];
+    switch (col.type) {
+      case COLUMN_INT:    col.ints.Push((value) ? value->IntValue() : 0); break;
+      case COLUMN_DOUBLE: col.doubles.Push((value) ? value->DoubleValue() : 0.0); break;
+      case COLUMN_STRING: col.strings.Push((value) ? value->StringValue() : Apto::String("")); break;
+      case COLUMN_INT64:  col.int64s.Push(packageInt64Value(Apto::GetInternalPtr(value))); break;
+      case COLUMN_UINT64: col.uint64s.Push(packageUInt64Value(Apto::GetInternalPtr(value))); break;
+      default: break;
+    }
+  }
+
+  if (m_updates.GetSize() >= m_block_rows) Flush();
+}
+
+
+void Avida::Data::ColumnarRecorder::NotifyRow(Update current_update, const Row& row)
+{
+  if (!recordsUpdate(current_update)) return;
+
+  if (!m_types_written) {
+    for (int i = 0; i < m_columns.GetSize(); i++) {
+      switch (row.TypeOf(i)) {
+        case VALUE_INT:    m_columns[i].type = COLUMN_INT; break;
+        case VALUE_DOUBLE: m_columns[i].type = COLUMN_DOUBLE; break;
+        default:           m_columns[i].type = packageColumnType(Apto::GetInternalPtr(row.PackageValue(i))); break;
+      }
+    }
+    writeTypes();
+  }
+
+  m_updates.Push(current_update);
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    Column& col = m_columns[i];
+    switch (col.type) {
+      case COLUMN_INT:    col.ints.Push(row.IntValue(i)); break;
+      case COLUMN_DOUBLE: col.doubles.Push(row.DoubleValue(i)); break;
+      case COLUMN_STRING: col.strings.Push(row.StringValue(i)); break;
+      case COLUMN_INT64:  col.int64s.Push(packageInt64Value(Apto::GetInternalPtr(row.PackageValue(i)))); break;
+      case COLUMN_UINT64: col.uint64s.Push(packageUInt64Value(Apto::GetInternalPtr(row.PackageValue(i)))); break;
+      default: break;
+    }
+  }
+
+  if (m_updates.GetSize() >= m_block_rows) Flush();
+}
+
+
+void Avida::Data::ColumnarRecorder::Flush()
+{
+  const int rows = m_updates.GetSize();
+  if (!rows || !m_fp.good()) return;
+
+  std::string payload;
+  for (int r = 0; r < rows; r++) appendValue<int>(payload, m_updates[r]);
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    Column& col = m_columns[i];
+    switch (col.type) {
+      case COLUMN_INT:    for (int r = 0; r < rows; r++) appendValue<int>(payload, col.ints[r]); break;
+      case COLUMN_DOUBLE: for (int r = 0; r < rows; r++) appendValue<double>(payload, col.doubles[r]); break;
+      case COLUMN_STRING: for (int r = 0; r < rows; r++) appendString(payload, col.strings[r]); break;
+      case COLUMN_INT64:  for (int r = 0; r < rows; r++) appendValue<long long>(payload, col.int64s[r]); break;
+      case COLUMN_UINT64: for (int r = 0; r < rows; r++) appendValue<unsigned long long>(payload, col.uint64s[r]); break;
+      default: break;
+    }
+  }
+  clearColumns();
+
+  unsigned char encoding = BLOCK_RAW;
+  std::string stored;
+#ifdef AVD_HAVE_ZLIB
+  if (m_compress) {
+    uLongf stored_size = compressBound(payload.size());
+    stored.resize(stored_size);
+    if (compress2(reinterpret_cast<Bytef*>(&stored[0]), &stored_size,
+                  reinterpret_cast<const Bytef*>(payload.data()), payload.size(), Z_DEFAULT_COMPRESSION) == Z_OK) {
+      stored.resize(stored_size);
+      encoding = BLOCK_ZLIB;
+    }
+  }
+#endif
+  if (encoding == BLOCK_RAW) stored.swap(payload);
+
+  std::string block_header;
+  appendValue<unsigned int>(block_header, rows);
+  appendValue<unsigned char>(block_header, encoding);
+  appendValue<unsigned int>(block_header, (encoding == BLOCK_RAW) ? stored.size() : payload.size());
+  appendValue<unsigned int>(block_header, stored.size());
+
+  m_fp.write(block_header.data(), block_header.size());
+  m_fp.write(stored.data(), stored.size());
+  m_fp.flush();
+}
+
+
+bool Avida::Data::ColumnarRecorder::CompressionAvailable()
+{
+#ifdef AVD_HAVE_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+void Avida::Data::ColumnarRecorder::writeHeader()
+{
+  std::string header(COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+  appendValue<unsigned int>(header, COLUMNAR_BYTE_ORDER);
+  appendValue<unsigned int>(header, m_columns.GetSize());
+  for (int i = 0; i < m_columns.GetSize(); i++) appendString(header, m_columns[i].data_id);
+  m_fp.write(header.data(), header.size());
+
+  m_types_offset = m_fp.tellp();
+  std::string types;
+  for (int i = 0; i < m_columns.GetSize(); i++) appendValue<unsigned char>(types, COLUMN_UNTYPED);
+  m_fp.write(types.data(), types.size());
+  m_fp.flush();
+}
+
+
+// Fills in the column types left untyped by writeHeader(), before the first block is written
+void Avida::Data::ColumnarRecorder::writeTypes()
+{
+  m_types_written = true;
+  if (!m_fp.good()) return;
+
+  std::string types;
+  for (int i = 0; i < m_columns.GetSize(); i++) appendValue<unsigned char>(types, m_columns[i].type);
+
+  const std::streampos end = m_fp.tellp();
+  m_fp.seekp(m_types_offset);
+  m_fp.write(types.data(), types.size());
+  m_fp.seekp(end);
+}
+
+
+void Avida::Data::ColumnarRecorder::clearColumns()
+{
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    Column& col = m_columns[i];
+    col.ints.Resize(0);
+    col.doubles.Resize(0);
+    col.strings.Resize(0);
+    col.int64s.Resize(0);
+    col.uint64s.Resize(0);
+  }
+  m_updates.Resize(0);
+}
+
+bool Avida::Data::ColumnarRecorder::recordsUpdate(Update current_update)
+{
+  if (m_first_update < 0) m_first_update = current_update;
+  return ((current_update - m_first_update) % m_interval) == 0;
+}
+
+
+
+bool Avida::Data::ColumnarReader::Open(const Apto::String& path)
+{
+  m_columns.Resize(0);
+  m_updates.Resize(0);
+  m_error = "";
+
+  m_fp.open((const char*)path, std::ios::in | std::ios::binary);
+  if (!m_fp.good()) {
+    m_error = Apto::FormatStr("unable to open '%s'", (const char*)path);
+    return false;
+  }
+
+  char magic[sizeof(COLUMNAR_MAGIC)];
+  m_fp.read(magic, sizeof(magic));
+  if (!m_fp.good() || memcmp(magic, COLUMNAR_MAGIC, sizeof(magic)) != 0) {
+    m_error = Apto::FormatStr("'%s' is not a columnar data file", (const char*)path);
+    return false;
+  }
+
+  unsigned int byte_order = 0;
+  unsigned int num_columns = 0;
+  if (!readValue(m_fp, byte_order) || !readValue(m_fp, num_columns)) {
+    m_error = "truncated header";
+    return false;
+  }
+  if (byte_order != COLUMNAR_BYTE_ORDER) {
+    m_error = "file was written on a machine with a different byte order";
+    return false;
+  }
+
+  m_columns.Resize(num_columns);
+  for (unsigned int i = 0; i < num_columns; i++) {
+    unsigned int len = 0;
+    if (!readValue(m_fp, len)) {
+      m_error = "invalid column description";
+      return false;
+    }
+    std::string name(len, '\0');
+    if (len) m_fp.read(&name[0], len);
+    if (!m_fp.good()) {
+      m_error = "truncated column description";
+      return false;
+    }
+    m_columns[i].data_id = name.c_str();
+  }
+  for (unsigned int i = 0; i < num_columns; i++) {
+    unsigned char type = 0;
+    if (!readValue(m_fp, type) || (type > COLUMN_UINT64 && type != COLUMN_UNTYPED)) {
+      m_error = "invalid column type";
+      return false;
+    }
+    m_columns[i].type = (ColumnType)type;
+  }
+
+  return true;
+}
+
+
+bool Avida::Data::ColumnarReader::ReadBlock()
+{
+  m_updates.Resize(0);
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    m_columns[i].ints.Resize(0);
+    m_columns[i].doubles.Resize(0);
+    m_columns[i].strings.Resize(0);
+    m_columns[i].int64s.Resize(0);
+    m_columns[i].uint64s.Resize(0);
+  }
+
+  unsigned int rows = 0;
+  if (!readValue(m_fp, rows)) return false;  // clean end of file
+
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    if (m_columns[i].type == COLUMN_UNTYPED) {
+      m_error = Apto::FormatStr("block found, but column '%s' has no type", (const char*)m_columns[i].data_id);
+      return false;
+    }
+  }
+
+  unsigned char encoding = 0;
+  unsigned int raw_size = 0;
+  unsigned int stored_size = 0;
+  if (!readValue(m_fp, encoding) || !readValue(m_fp, raw_size) || !readValue(m_fp, stored_size)) {
+    m_error = "truncated block header";
+    return false;
+  }
+
+  std::string stored(stored_size, '\0');
+  if (stored_size) m_fp.read(&stored[0], stored_size);
+  if ((unsigned int)m_fp.gcount() != stored_size) {
+    m_error = "truncated block";
+    return false;
+  }
+
+  std::string payload;
+  if (encoding == BLOCK_RAW) {
+    payload.swap(stored);
+  } else if (encoding == BLOCK_ZLIB) {
+#ifdef AVD_HAVE_ZLIB
+    payload.resize(raw_size);
+    uLongf payload_size = raw_size;
+    if (uncompress(reinterpret_cast<Bytef*>(&payload[0]), &payload_size,
+                   reinterpret_cast<const Bytef*>(stored.data()), stored.size()) != Z_OK || payload_size != raw_size) {
+      m_error = "corrupt compressed block";
+      return false;
+    }
+#else
+    m_error = "compressed block encountered, but compression support is not available";
+    return false;
+#endif
+  } else {
+    m_error = "unknown block encoding";
+    return false;
+  }
+
+  size_t offset = 0;
+  m_updates.Resize(rows);
+  for (unsigned int r = 0; r < rows; r++) {
+    int update = 0;
+    if (!extractValue(payload, offset, update)) {
+      m_error = "truncated update column";
+      return false;
+    }
+    m_updates[r] = update;
+  }
+
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    Column& col = m_columns[i];
+    bool ok = true;
+    switch (col.type) {
+      case COLUMN_INT:
+        col.ints.Resize(rows);
+        for (unsigned int r = 0; ok && r < rows; r++) ok = extractValue(payload, offset, col.ints[r]);
+        break;
+      case COLUMN_DOUBLE:
+        col.doubles.Resize(rows);
+        for (unsigned int r = 0; ok && r < rows; r++) ok = extractValue(payload, offset, col.doubles[r]);
+        break;
+      case COLUMN_STRING:
+        col.strings.Resize(rows);
+        for (unsigned int r = 0; ok && r < rows; r++) ok = extractString(payload, offset, col.strings[r]);
+        break;
+      case COLUMN_INT64:
+        col.int64s.Resize(rows);
+        for (unsigned int r = 0; ok && r < rows; r++) ok = extractValue(payload, offset, col.int64s[r]);
+        break;
+      case COLUMN_UINT64:
+        col.uint64s.Resize(rows);
+        for (unsigned int r = 0; ok && r < rows; r++) ok = extractValue(payload, offset, col.uint64s[r]);
+        break;
+      default:
+        ok = false;
+        break;
+    }
+    if (!ok) {
+      m_error = Apto::FormatStr("truncated column '%s'", (const char*)col.data_id);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+bool Avida::Data::ColumnarReader::ExportText(std::ostream& out)
+{
+  out << "#  1: Update" << std::endl;
+  for (int i = 0; i < m_columns.GetSize(); i++) {
+    out << (const char*)Apto::FormatStr("# %2d: %s", i + 2, (const char*)m_columns[i].data_id) << std::endl;
+  }
+  out << std::endl;
+
+  while (ReadBlock()) {
+    for (int r = 0; r < NumRows(); r++) {
+      out << m_updates[r] << " ";
+      for (int i = 0; i < m_columns.GetSize(); i++) {
+        switch (m_columns[i].type) {
+          case COLUMN_INT:    out << m_columns[i].ints[r] << " "; break;
+          case COLUMN_DOUBLE: out << m_columns[i].doubles[r] << " "; break;
+          case COLUMN_STRING: out << (const char*)m_columns[i].strings[r] << " "; break;
+          case COLUMN_INT64:  out << m_columns[i].int64s[r] << " "; break;
+          case COLUMN_UINT64: out << m_columns[i].uint64s[r] << " "; break;
+          default: break;
+        }
+      }
+      out << "\n";
+    }
+  }
+
+  return (m_error.GetSize() == 0 && out.good());
+}
@@ -28,6 +28,7 @@
 #include "avida/data/Package.h"
 #include "avida/data/Provider.h"
 #include "avida/data/Recorder.h"
+#include "avida/data/Util.h"
 
 #include <cassert>
 
@@ -42,6 +43,26 @@ bool Avida::Data::Manager::s_registered_with_facet_factory =
   Avida::WorldFacet::RegisterFacetType(Avida::Reserved::DataManagerFacetID, DeserializeDataManager);
 
 
+// Data::Manager::RecordingPlan - Data values of a row recorder, resolved to their providers when attached
+// --------------------------------------------------------------------------------------------------------------
+
+struct Avida::Data::Manager::RecordingPlan
+{
+  struct Entry
+  {
+    ProviderPtr provider;              // provider of the value, also set for typed argumented values
+    ArgumentedProviderPtr arg_provider;
+    DataID data_id;                    // raw id "name[]" for argumented values
+    Argument argument;
+    int slot;                          // typed slot within provider, -1 if the value must be packaged
+  };
+  
+  RecorderPtr recorder;
+  Apto::Array<Entry> entries;
+  Row row;
+};
+
+
 Avida::Data::Manager::Manager() : m_world(NULL), m_available(new DataSet)
 {
   
@@ -49,6 +70,7 @@ Avida::Data::Manager::Manager() : m_world(NULL), m_available(new DataSet)
 
 Avida::Data::Manager::~Manager()
 {
+  for (int i = 0; i < m_plans.GetSize(); i++) delete m_plans[i];
 }
 
 
@@ -90,19 +112,9 @@ Apto::String Avida::Data::Manager::Describe(const DataID& data_id) const
   
   if (data_id[data_id.GetSize() - 1] == ']') {
     // Handle argumented data value
-    
-    // Find start of argument
-    int start_idx = -1;
-    for (int i = 0; i < data_id.GetSize(); i++) {
-      if (data_id[i] == '[') {
-        start_idx = i + 1;
-        break;
-      }
-    }
-    if (start_idx == -1) return "";  // argument start not found
-    
-    // Separate argument from incoming requested data id
-    DataID raw_id = data_id.Substring(0, start_idx) + "]";
+    DataID raw_id;
+    Argument argument;
+    if (!SplitArgumentedID(data_id, raw_id, argument)) return "";  // argument start not found
     
     // Check if argumented provider exists for requested data
     ArgumentedProviderPtr provider;
@@ -136,20 +148,9 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder, bool concurrent_
     
     if (data_id[data_id.GetSize() - 1] == ']') {
       // Handle argumented data value
-      
-      // Find start of argument
-      int start_idx = -1;
-      for (int i = 0; i < data_id.GetSize(); i++) {
-        if (data_id[i] == '[') {
-          start_idx = i + 1;
-          break;
-        }
-      }
-      if (start_idx == -1) return false;  // argument start not found
-      
-      // Separate argument from incoming requested data id
-      Apto::String argument = data_id.Substring(start_idx, data_id.GetSize() - start_idx - 1);
-      DataID raw_id = data_id.Substring(0, start_idx) + "]";
+      DataID raw_id;
+      Argument argument;
+      if (!SplitArgumentedID(data_id, raw_id, argument)) return false;  // argument start not found
       
       // Check if argumented provider exists for requested data
       if (!m_arg_provider_map.Has(raw_id)) return false;
@@ -189,20 +190,9 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder, bool concurrent_
     if (rdid[rdid.GetSize() - 1] == ']') {
       
       // Handle argumented data value      
-      
-      // Find start of argument
-      int start_idx = -1;
-      for (int i = 0; i < rdid.GetSize(); i++) {
-        if (rdid[i] == '[') {
-          start_idx = i + 1;
-          break;
-        }
-      }
-      if (start_idx == -1) return false;  // argument start not found
-      
-      // Separate argument from incoming requested data id
-      Apto::String argument = rdid.Substring(start_idx, rdid.GetSize() - start_idx - 1);
-      DataID raw_id = rdid.Substring(0, start_idx) + "]";
+      DataID raw_id;
+      Argument argument;
+      if (!SplitArgumentedID(rdid, raw_id, argument)) return false;  // argument start not found
 
       ArgumentedProviderPtr provider = m_active_arg_provider_map[raw_id];
       if (!provider) return false; // Argumented providers should be activated above, whaa??
@@ -293,6 +283,10 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder, bool concurrent_
     }
   }
   
+  // Resolve the values of row recorders to their providers once, rather than by id every update
+  const Apto::Array<DataID>* layout = recorder->RowLayout();
+  RecordingPlan* plan = (layout) ? compilePlan(recorder, *layout) : NULL;
+  
   m_rwlock.WriteUnlock();
   
   
@@ -309,13 +303,19 @@ bool Avida::Data::Manager::AttachRecorder(RecorderPtr recorder, bool concurrent_
         m_current_value_mutex.Unlock();
       }
     }
-    DataRetrievalFunctor drf(this, &Manager::GetCurrentValue);
-    recorder->NotifyData(UPDATE_CONCURRENT, drf);
+    if (plan) {
+      collectRow(*plan);
+      recorder->NotifyRow(UPDATE_CONCURRENT, plan->row);
+    } else {
+      DataRetrievalFunctor drf(this, &Manager::GetCurrentValue);
+      recorder->NotifyData(UPDATE_CONCURRENT, drf);
+    }
   }
   
   // Store the recorder
   m_recorder_mutex.Lock();
-  m_recorders.Insert(recorder);
+  if (plan) m_plans.Push(plan);
+  else m_recorders.Insert(recorder);
   m_recorder_mutex.Unlock();
   return true;
 }
@@ -325,6 +325,14 @@ bool Avida::Data::Manager::DetachRecorder(RecorderPtr recorder)
   bool success = false;
   m_recorder_mutex.Lock();
   success = m_recorders.Remove(recorder);
+  for (int i = 0; !success && i < m_plans.GetSize(); i++) {
+    if (Apto::GetInternalPtr(m_plans[i]->recorder) == Apto::GetInternalPtr(recorder)) {
+      delete m_plans[i];
+      m_plans[i] = m_plans[m_plans.GetSize() - 1];
+      m_plans.Pop();
+      success = true;
+    }
+  }
   // @TODO - this should probably deactivate data providers that are no longer needed, or at least adjust schedule
   m_recorder_mutex.Unlock();
   return success;
@@ -439,6 +447,10 @@ void Avida::Data::Manager::PerformUpdate(Context&, Update current_update)
   for (Apto::Set<RecorderPtr>::Iterator it = m_recorders.Begin(); it.Next();) {
     (*it.Get())->NotifyData(current_update, drf);
   }
+  for (int i = 0; i < m_plans.GetSize(); i++) {
+    collectRow(*m_plans[i]);
+    m_plans[i]->recorder->NotifyRow(current_update, m_plans[i]->row);
+  }
   m_recorder_mutex.Unlock();
 }
 
@@ -450,19 +462,9 @@ Avida::Data::PackagePtr Avida::Data::Manager::GetCurrentValue(const DataID& data
   if (m_current_values.Get(data_id, rtn)) return rtn;
   
   if (data_id[data_id.GetSize() - 1] == ']') {
-    // Find start of argument
-    int start_idx = -1;
-    for (int i = 0; i < data_id.GetSize(); i++) {
-      if (data_id[i] == '[') {
-        start_idx = i + 1;
-        break;
-      }
-    }
-    if (start_idx == -1) return rtn;  // argument start not found
-    
-    // Separate argument from incoming requested data id
-    Apto::String argument = data_id.Substring(start_idx, data_id.GetSize() - start_idx - 1);
-    DataID raw_id = data_id.Substring(0, start_idx) + "]";
+    DataID raw_id;
+    Argument argument;
+    if (!SplitArgumentedID(data_id, raw_id, argument)) return rtn;  // argument start not found
     
     m_rwlock.ReadLock();
     ArgumentedProviderPtr arg_provider;
@@ -484,3 +486,56 @@ Avida::Data::PackagePtr Avida::Data::Manager::GetCurrentValue(const DataID& data
   return rtn;
 }
 
+
+Avida::Data::Manager::RecordingPlan* Avida::Data::Manager::compilePlan(RecorderPtr recorder,
+                                                                       const Apto::Array<DataID>& layout) const
+{
+  RecordingPlan* plan = new RecordingPlan;
+  plan->recorder = recorder;
+  plan->entries.Resize(layout.GetSize());
+  plan->row.Resize(layout.GetSize());
+  
+  for (int i = 0; i < layout.GetSize(); i++) {
+    RecordingPlan::Entry& entry = plan->entries[i];
+    ValueType type = VALUE_PACKAGE;
+    entry.slot = -1;
+    
+    if (IsArgumentedID(layout[i])) {
+      if (SplitArgumentedID(layout[i], entry.data_id, entry.argument) &&
+          m_active_arg_provider_map.Get(entry.data_id, entry.arg_provider)) {
+        entry.slot = entry.arg_provider->ResolveProvidedSlot(layout[i], type);
+        if (entry.slot >= 0) entry.provider = entry.arg_provider;
+      }
+    } else {
+      entry.data_id = layout[i];
+      if (m_active_provider_map.Get(entry.data_id, entry.provider)) {
+        entry.slot = entry.provider->ResolveProvidedSlot(entry.data_id, type);
+      }
+    }
+    
+    plan->row.SetType(i, (entry.slot >= 0) ? type : VALUE_PACKAGE);
+  }
+  
+  return plan;
+}
+
+
+void Avida::Data::Manager::collectRow(RecordingPlan& plan) const
+{
+  Row& row = plan.row;
+  for (int i = 0; i < plan.entries.GetSize(); i++) {
+    const RecordingPlan::Entry& entry = plan.entries[i];
+    switch (row.TypeOf(i)) {
+      case VALUE_INT:
+        row.SetInt(i, entry.provider->ProvidedIntValue(entry.slot));
+        break;
+      case VALUE_DOUBLE:
+        row.SetDouble(i, entry.provider->ProvidedDoubleValue(entry.slot));
+        break;
+      default:
+        if (entry.arg_provider) row.SetPackage(i, entry.arg_provider->GetProvidedValueForArgument(entry.data_id, entry.argument));
+        else if (entry.provider) row.SetPackage(i, entry.provider->GetProvidedValue(entry.data_id));
+        break;
+    }
+  }
+}
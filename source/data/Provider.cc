@@ -27,12 +27,32 @@
 #include "avida/data/Package.h"
 #include "avida/data/Util.h"
 
+#include <cassert>
+
 
 bool Avida::Data::Provider::SupportsConcurrentUpdate() const
 {
   return false;
 }
 
+int Avida::Data::Provider::ResolveProvidedSlot(const DataID&, ValueType& type) const
+{
+  type = VALUE_PACKAGE;
+  return -1;
+}
+
+int Avida::Data::Provider::ProvidedIntValue(int) const
+{
+  assert(false);
+  return 0;
+}
+
+double Avida::Data::Provider::ProvidedDoubleValue(int) const
+{
+  assert(false);
+  return 0.0;
+}
+
 
 Avida::Data::PackagePtr Avida::Data::ArgumentedProvider::GetProvidedValuesForArguments(const DataID& data_id,
                                                                                        ConstArgumentSetPtr args) const
@@ -54,20 +74,8 @@ Avida::Data::PackagePtr Avida::Data::ArgumentedProvider::GetProvidedValue(const
   if (IsStandardID(data_id)) {
     return GetProvidedValueForArgument(data_id, argument);
   } else if (IsArgumentedID(data_id)) {    
-    // Find start of argument
-    int start_idx = -1;
-    for (int i = 0; i < data_id.GetSize(); i++) {
-      if (data_id[i] == '[') {
-        start_idx = i + 1;
-        break;
-      }
-    }
-    if (start_idx != -1) {
-      // Separate argument from incoming requested data id
-      argument = data_id.Substring(start_idx, data_id.GetSize() - start_idx - 1);
-      DataID raw_id = data_id.Substring(0, start_idx) + "]";
-      return GetProvidedValueForArgument(raw_id, argument);
-    }
+    DataID raw_id;
+    if (SplitArgumentedID(data_id, raw_id, argument)) return GetProvidedValueForArgument(raw_id, argument);
   }
   
   return pkg;
@@ -24,4 +24,30 @@
 
 #include "avida/data/Recorder.h"
 
+#include <cassert>
+
+
 Avida::Data::Recorder::~Recorder() { ; }
+
+
+const Apto::Array<Avida::Data::DataID>* Avida::Data::Recorder::RowLayout() const
+{
+  return NULL;
+}
+
+void Avida::Data::Recorder::NotifyRow(Update, const Row&)
+{
+  assert(false);
+}
+
+
+void Avida::Data::Row::Resize(int size)
+{
+  m_types.Resize(size);
+  m_ints.Resize(size);
+  m_doubles.Resize(size);
+  m_packages.Resize(size);
+  m_types.SetAll(VALUE_PACKAGE);
+  m_ints.SetAll(0);
+  m_doubles.SetAll(0.0);
+}
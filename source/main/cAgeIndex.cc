@@ -0,0 +1,159 @@
+/*
+ *  cAgeIndex.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cAgeIndex.h"
+
+#include "apto/rng.h"
+
+#include "cOrganism.h"
+#include "cPhenotype.h"
+
+#include <cassert>
+
+
+static const int INITIAL_AGE_BUCKETS = 64;
+
+
+cAgeIndex::cAgeIndex() : m_pass(0), m_oldest(0)
+{
+  m_buckets.Resize(INITIAL_AGE_BUCKETS);
+}
+
+
+inline int cAgeIndex::currentStamp(cOrganism* org) const
+{
+  return m_pass - org->GetPhenotype().GetAge();
+}
+
+
+void cAgeIndex::Insert(cOrganism* org)
+{
+  place(org, currentStamp(org));
+}
+
+
+void cAgeIndex::Remove(cOrganism* org)
+{
+  if (org->GetAgeIndexPos() < 0) return;
+  unplace(org);
+}
+
+
+void cAgeIndex::AdvancePass()
+{
+  m_pass++;
+  if (m_pass - m_oldest >= m_buckets.GetSize()) rebuild(m_oldest);
+  settleOldest();
+}
+
+
+// Rejection sampling within the oldest bucket, stale entries are moved out as they are drawn.  Each draw is uniform
+// over the entries that remain, so the result is uniform over the valid entries other than exclude.
+cOrganism* cAgeIndex::FindEldest(Apto::Random& rng, cOrganism* exclude)
+{
+  for (int stamp = m_oldest; stamp <= m_pass; stamp++) {
+    Apto::Array<cOrganism*, Apto::Smart>& cur_bucket = bucket(stamp);
+    while (cur_bucket.GetSize()) {
+      cOrganism* org = (cur_bucket.GetSize() == 1) ? cur_bucket[0] : cur_bucket[rng.GetUInt(cur_bucket.GetSize())];
+      
+      const int org_stamp = currentStamp(org);
+      if (org_stamp != stamp) {
+        unplace(org);
+        place(org, org_stamp);
+        continue;
+      }
+      
+      if (org != exclude) return org;
+      if (cur_bucket.GetSize() == 1) break;
+    }
+  }
+  
+  return NULL;
+}
+
+
+void cAgeIndex::place(cOrganism* org, int stamp)
+{
+  assert(stamp <= m_pass);
+  if (stamp < m_oldest) {
+    if (m_pass - stamp >= m_buckets.GetSize()) rebuild(stamp);
+    m_oldest = stamp;
+  }
+  
+  Apto::Array<cOrganism*, Apto::Smart>& cur_bucket = bucket(stamp);
+  org->SetAgeIndexPos(stamp, cur_bucket.GetSize());
+  cur_bucket.Push(org);
+}
+
+
+void cAgeIndex::unplace(cOrganism* org)
+{
+  Apto::Array<cOrganism*, Apto::Smart>& cur_bucket = bucket(org->GetAgeStamp());
+  const int pos = org->GetAgeIndexPos();
+  assert(cur_bucket[pos] == org);
+  
+  cOrganism* last = cur_bucket[cur_bucket.GetSize() - 1];
+  cur_bucket[pos] = last;
+  last->SetAgeIndexPos(last->GetAgeStamp(), pos);
+  cur_bucket.Pop();
+  
+  org->SetAgeIndexPos(org->GetAgeStamp(), -1);
+}
+
+
+// Moves stale entries out of the oldest buckets, so that the ring only needs to span the true age range
+void cAgeIndex::settleOldest()
+{
+  while (m_oldest < m_pass) {
+    Apto::Array<cOrganism*, Apto::Smart>& cur_bucket = bucket(m_oldest);
+    for (int i = cur_bucket.GetSize() - 1; i >= 0; i--) {
+      cOrganism* org = cur_bucket[i];
+      const int org_stamp = currentStamp(org);
+      if (org_stamp != m_oldest) {
+        unplace(org);
+        place(org, org_stamp);
+      }
+    }
+    if (cur_bucket.GetSize()) break;
+    m_oldest++;
+  }
+}
+
+
+// Resizes the ring to cover the stamps from oldest through the current pass
+void cAgeIndex::rebuild(int oldest)
+{
+  Apto::Array<cOrganism*, Apto::Smart> orgs;
+  for (int b = 0; b < m_buckets.GetSize(); b++) {
+    for (int i = 0; i < m_buckets[b].GetSize(); i++) orgs.Push(m_buckets[b][i]);
+    m_buckets[b].Resize(0);
+  }
+  
+  int size = m_buckets.GetSize();
+  while (m_pass - oldest >= size) size *= 2;
+  m_buckets.Resize(size);
+  
+  for (int i = 0; i < orgs.GetSize(); i++) {
+    Apto::Array<cOrganism*, Apto::Smart>& cur_bucket = bucket(orgs[i]->GetAgeStamp());
+    orgs[i]->SetAgeIndexPos(orgs[i]->GetAgeStamp(), cur_bucket.GetSize());
+    cur_bucket.Push(orgs[i]);
+  }
+}
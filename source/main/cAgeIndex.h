@@ -0,0 +1,81 @@
+/*
+ *  cAgeIndex.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cAgeIndex_h
+#define cAgeIndex_h
+
+#include "apto/core/Array.h"
+
+class cOrganism;
+
+namespace Apto {
+  class Random;
+};
+
+
+// cAgeIndex - Live organisms bucketed by the age pass in which their current age began, for finding the eldest
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Ages are incremented once per update pass (cPopulation::UpdateOrganismStats), so an organism's age is the number
+//  of passes since its stamp.  Ages may also be reset to zero (e.g. on divide) without notifying the index, which
+//  only ever makes the true stamp newer; such stale entries are moved to their proper bucket when they are found at
+//  the old end of the index.  Buckets are kept in a ring covering the stamps from the oldest entry to the current pass.
+
+class cAgeIndex
+{
+private:
+  Apto::Array<Apto::Array<cOrganism*, Apto::Smart>, Apto::ManagedPointer> m_buckets;  // stamp s at s mod size
+  int m_pass;       // completed age passes
+  int m_oldest;     // no bucket older than this holds organisms
+
+
+  cAgeIndex(const cAgeIndex&); // @not_implemented
+  cAgeIndex& operator=(const cAgeIndex&); // @not_implemented
+
+public:
+  cAgeIndex();
+
+  void Insert(cOrganism* org);
+  void Remove(cOrganism* org);
+
+  // Must be called after the ages of all live organisms have been incremented
+  void AdvancePass();
+
+  // Chooses uniformly among the oldest organisms other than exclude, NULL if there are none
+  cOrganism* FindEldest(Apto::Random& rng, cOrganism* exclude);
+
+private:
+  inline Apto::Array<cOrganism*, Apto::Smart>& bucket(int stamp);
+  inline int currentStamp(cOrganism* org) const;
+  void place(cOrganism* org, int stamp);
+  void unplace(cOrganism* org);
+  void settleOldest();
+  void rebuild(int oldest);
+};
+
+
+inline Apto::Array<cOrganism*, Apto::Smart>& cAgeIndex::bucket(int stamp)
+{
+  const int size = m_buckets.GetSize();
+  return m_buckets[((stamp % size) + size) % size];
+}
+
+#endif
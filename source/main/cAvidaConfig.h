@@ -360,6 +360,7 @@ public:
   CONFIG_ADD_VAR(META_COPY_MUT, double, 0.0, "Prob. of copy mutation rate changing (per gen)");
   CONFIG_ADD_VAR(META_STD_DEV, double, 0.0, "Standard deviation of meta mutation size.");
   CONFIG_ADD_VAR(MUT_RATE_SOURCE, int, 1, "1 = Mutation rates determined by environment.\n2 = Mutation rates inherited from parent.");
+  CONFIG_ADD_VAR(MUTATION_INST_SAMPLER, int, 0, "How the instruction for each mutation is drawn, in proportion to its redundancy:\n0 = Search of cumulative weights (original behavior)\n1 = Alias table, constant time per draw, but a given random draw selects a\n    different instruction than with 0");
   
   
   // -------- Birth and Death config options --------
@@ -531,6 +532,8 @@ public:
   CONFIG_ADD_ALIAS(FAIL_IMPLICIT);
   CONFIG_ADD_VAR(NEUTRAL_MAX,double, 0.0, "Percent benifical change from parent fitness to be considered neutral.");
   CONFIG_ADD_VAR(NEUTRAL_MIN,double, 0.0, "Percent deleterious change from parent fitness to be considered neutral.");
+  CONFIG_ADD_VAR(DIVIDE_TEST_CACHE_SIZE, int, 0, "Number of offspring test results to cache by genome, so repeated mutants are not re-tested.\n0 = caching disabled");
+  CONFIG_ADD_VAR(DIVIDE_TEST_DEFER, int, 0, "Hold divides that require an offspring test until the update's steps are done,\nthen test them in parallel on the analyze job queue and complete them in order\nbefore post-update stats and actions run.\n0 = test immediately (original behavior)\n1 = defer and batch tests");
 
   
   // -------- Time Slicing config options --------
@@ -624,10 +627,23 @@ public:
   // -------- Analyze config options --------
   CONFIG_ADD_GROUP(ANALYZE_GROUP, "Analysis Settings");
   CONFIG_ADD_VAR(MAX_CONCURRENCY, int, -1, "Maximum number of analyze threads, -1 == use all available.");
+  CONFIG_ADD_VAR(PARALLEL_TEST_BATCHES, int, 0, "Spread batched test CPU runs (recalculation, plasticity, knockouts) over the analyze threads?\n0 = No, test in order on the calling thread's random stream (original results)\n1 = Yes, each test gets its own seeded random stream, so results differ from 0");
   CONFIG_ADD_VAR(INJECT_RESETS_TASKS, int, 0, "Executing INJECT (semi-succesfully) will trigger last_task_count to be writen from current_task_count");
   CONFIG_ADD_VAR(ANALYZE_OPTION_1, cString, "", "String variable accessible from analysis scripts");
   CONFIG_ADD_VAR(ANALYZE_OPTION_2, cString, "", "String variable accessible from analysis scripts");
-  
+
+
+  // -------- Profiling config options --------
+  CONFIG_ADD_GROUP(PROFILE_GROUP, "Execution Profiling");
+  CONFIG_ADD_VAR(PROFILE_EXECUTION, int, 0, "Collect per-instruction execution counts and per-update phase timings (see PrintProfile)\n0 = disabled\n1 = enabled");
+  CONFIG_ADD_VAR(PROFILE_SAMPLE_INTERVAL, int, 1000, "Time one out of every N executed instructions, per instruction set, when profiling");
+
+
+  // -------- Output config options --------
+  CONFIG_ADD_GROUP(OUTPUT_GROUP, "Data File Output");
+  CONFIG_ADD_VAR(ASYNC_OUTPUT, int, 0, "Write data files from a background thread\n0 = disabled (rows are written as they are produced)\n1 = enabled (rows are buffered in memory and written in the background, all output is flushed by SavePopulation and at exit)");
+  CONFIG_ADD_VAR(ASYNC_OUTPUT_QUEUE_SIZE, int, 16384, "Maximum kilobytes of output waiting to be written before the simulation waits on the writer");
+
 
   // -------- Energy Model config options --------
   CONFIG_ADD_GROUP(ENERGY_GROUP, "Energy Settings");
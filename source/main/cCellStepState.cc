@@ -0,0 +1,35 @@
+/*
+ *  cCellStepState.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cCellStepState.h"
+
+
+void cCellStepState::Resize(int num_cells)
+{
+  m_organisms.ResizeClear(num_cells);
+  m_organisms.SetAll(NULL);
+  m_hardware.ResizeClear(num_cells);
+  m_hardware.SetAll(NULL);
+  m_spec_states.ResizeClear(num_cells);
+  m_spec_states.SetAll(0);
+  m_deme_ids.ResizeClear(num_cells);
+  m_deme_ids.SetAll(-1);
+}
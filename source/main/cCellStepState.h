@@ -0,0 +1,72 @@
+/*
+ *  cCellStepState.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cCellStepState_h
+#define cCellStepState_h
+
+#include "apto/core/Array.h"
+
+#include <cassert>
+
+class cHardwareBase;
+class cOrganism;
+
+
+// cCellStepState - Per cell copies of the fields read by every scheduler step, stored as parallel arrays by cell ID
+// --------------------------------------------------------------------------------------------------------------
+//
+//  ProcessStep and ProcessStepSpeculative read these instead of walking each cPopulationCell.  Occupants are kept
+//  current by cPopulationCell.  Merit is not copied here, it changes in too many places outside of AdjustSchedule, so
+//  it is still read from the organism's phenotype.  The speculative execution counters live only here.
+
+class cCellStepState
+{
+private:
+  Apto::Array<cOrganism*> m_organisms;      // NULL when the cell is empty
+  Apto::Array<cHardwareBase*> m_hardware;
+  Apto::Array<int> m_spec_states;           // instructions already executed ahead of the scheduler
+  Apto::Array<int> m_deme_ids;
+
+
+  cCellStepState(const cCellStepState&); // @not_implemented
+  cCellStepState& operator=(const cCellStepState&); // @not_implemented
+
+public:
+  cCellStepState() { ; }
+
+  // Clears all cells
+  void Resize(int num_cells);
+
+  inline bool IsOccupied(int cell_id) const { return m_organisms[cell_id] != NULL; }
+  inline cOrganism* GetOrganism(int cell_id) const { return m_organisms[cell_id]; }
+  inline cHardwareBase* GetHardware(int cell_id) const { return m_hardware[cell_id]; }
+  inline int GetDemeID(int cell_id) const { return m_deme_ids[cell_id]; }
+
+  inline void SetOccupant(int cell_id, cOrganism* org, cHardwareBase* hw)
+    { assert((org == NULL) == (hw == NULL)); m_organisms[cell_id] = org; m_hardware[cell_id] = hw; }
+  inline void SetDemeID(int cell_id, int deme_id) { m_deme_ids[cell_id] = deme_id; }
+
+  inline int GetSpeculativeState(int cell_id) const { return m_spec_states[cell_id]; }
+  inline void SetSpeculativeState(int cell_id, int count) { m_spec_states[cell_id] = count; }
+  inline void DecSpeculative(int cell_id) { m_spec_states[cell_id]--; }
+};
+
+#endif
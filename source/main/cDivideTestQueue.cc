@@ -0,0 +1,209 @@
+/*
+ *  cDivideTestQueue.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cDivideTestQueue.h"
+
+#include "apto/rng.h"
+
+#include "cAnalyzeJobQueue.h"
+#include "cAvidaContext.h"
+#include "cCPUTestInfo.h"
+#include "cHardwareBase.h"
+#include "cHardwareManager.h"
+#include "cOrganism.h"
+#include "cPhenotype.h"
+#include "cPopulation.h"
+#include "cPopulationCell.h"
+#include "cTestCPU.h"
+#include "cWorld.h"
+#include "tAnalyzeJobBatch.h"
+
+
+class cDivideTestQueue::cTestJob
+{
+private:
+  cWorld* m_world;
+  Genome m_genome;
+  int m_seed;
+
+public:
+  Apto::String key;
+  sResult result;
+
+  cTestJob(cWorld* world, const Genome& genome, const Apto::String& in_key, int seed)
+    : m_world(world), m_genome(genome), m_seed(seed), key(in_key) { ; }
+
+  void Run(cAvidaContext& ctx)
+  {
+    // Each test draws its random inputs from its own stream, so the outcome does not depend on thread scheduling
+    Apto::RNG::AvidaRNG rng(m_seed);
+    cAvidaContext test_ctx(&ctx.Driver(), rng);
+
+    cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(test_ctx);
+    cCPUTestInfo test_info;
+    test_info.UseRandomInputs();
+    testcpu->TestGenome(test_ctx, test_info, m_genome);
+    delete testcpu;
+
+    result.is_viable = test_info.IsViable();
+    result.fitness = test_info.GetGenotypeFitness();
+    result.max_depth = test_info.GetMaxDepth();
+    result.task_counts = test_info.GetTestPhenotype().GetLastTaskCount();
+  }
+};
+
+
+cDivideTestQueue::cDivideTestQueue(cWorld* world)
+  : m_world(world)
+  , m_defer(world->GetConfig().DIVIDE_TEST_DEFER.Get())
+  , m_cache_next(0)
+{
+  const int cache_size = world->GetConfig().DIVIDE_TEST_CACHE_SIZE.Get();
+  if (cache_size > 0) m_cache_keys.Resize(cache_size);
+}
+
+
+bool cDivideTestQueue::HasResult(const Genome& genome) const
+{
+  if (!m_cache_keys.GetSize() && !m_committed.GetSize()) return false;
+
+  sResult result;
+  return lookupResult(genome.AsString(), result);
+}
+
+
+void cDivideTestQueue::TestGenome(cAvidaContext& ctx, const Genome& genome, sResult& result)
+{
+  Apto::String key;
+  if (m_cache_keys.GetSize() || m_committed.GetSize()) {
+    key = genome.AsString();
+    if (lookupResult(key, result)) return;
+  }
+
+  cTestCPU* testcpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  cCPUTestInfo test_info;
+  test_info.UseRandomInputs();
+  testcpu->TestGenome(ctx, test_info, genome);
+  delete testcpu;
+
+  result.is_viable = test_info.IsViable();
+  result.fitness = test_info.GetGenotypeFitness();
+  result.max_depth = test_info.GetMaxDepth();
+  result.task_counts = test_info.GetTestPhenotype().GetLastTaskCount();
+
+  if (m_cache_keys.GetSize()) cacheResult(key, result);
+}
+
+
+void cDivideTestQueue::DeferDivide(cOrganism* org)
+{
+  org->SetDivideTestPending(true);
+  m_deferred.Push(sDeferredDivide(org->GetCellID(), org->GetID()));
+  m_deferred_genomes.Push(org->OffspringGenome());
+}
+
+
+void cDivideTestQueue::ProcessDeferred(cAvidaContext& ctx)
+{
+  if (m_deferred.GetSize() == 0) return;
+
+  // Swap out the deferred divides, so that any divides requested while committing are handled in the next batch
+  Apto::Array<sDeferredDivide> deferred(m_deferred);
+  Apto::Array<Genome> genomes(m_deferred_genomes);
+  m_deferred.Resize(0);
+  m_deferred_genomes.Resize(0);
+
+  // Collect each distinct genome that still needs to be tested.  Seeds are drawn in request order, so the results
+  // are identical regardless of the number of worker threads.
+  Apto::Array<cTestJob*> jobs;
+  Apto::Map<Apto::String, int> scheduled;
+  sResult result;
+  for (int i = 0; i < genomes.GetSize(); i++) {
+    Apto::String key = genomes[i].AsString();
+    if (scheduled.Has(key) || lookupResult(key, result)) continue;
+    scheduled.Set(key, jobs.GetSize());
+    jobs.Push(new cTestJob(m_world, genomes[i], key, ctx.GetRandom().GetInt(ctx.GetRandom().MaxSeed())));
+  }
+
+  if (jobs.GetSize()) {
+    tAnalyzeJobBatch<cTestJob> jobbatch(m_world->GetJobQueue());
+    for (int i = 0; i < jobs.GetSize(); i++) jobbatch.AddJob(jobs[i], &cTestJob::Run);
+    jobbatch.RunBatch();
+
+    for (int i = 0; i < jobs.GetSize(); i++) {
+      m_committed.Set(jobs[i]->key, jobs[i]->result);
+      if (m_cache_keys.GetSize()) cacheResult(jobs[i]->key, jobs[i]->result);
+      delete jobs[i];
+    }
+  }
+
+  // Complete the held divides in the order they were requested.  Parents that have died since are simply dropped.
+  for (int i = 0; i < deferred.GetSize(); i++) {
+    cOrganism* org = findDeferredOrganism(deferred[i]);
+    if (org == NULL) continue;
+
+    org->SetDivideTestPending(false);
+
+    // Mark the parent as running, as SingleProcess does, so that an offspring placed over it only flags it for
+    // deletion while the divide is still using it
+    org->SetRunning(true);
+    org->GetHardware().Divide_CompleteDeferred(ctx);
+    org->SetRunning(false);
+    if (org->GetPhenotype().GetToDelete()) {
+      org->GetHardware().DeleteMiniTrace(m_world->GetPopulation().GetMiniTracePrintReactions());
+      delete org;
+    }
+  }
+
+  m_committed.Clear();
+}
+
+
+bool cDivideTestQueue::lookupResult(const Apto::String& key, sResult& result) const
+{
+  if (m_committed.Get(key, result)) return true;
+  return m_cache.Get(key, result);
+}
+
+
+void cDivideTestQueue::cacheResult(const Apto::String& key, const sResult& result)
+{
+  if (m_cache.Has(key)) return;
+
+  // Evict the oldest entry once the cache is full
+  if (m_cache_keys[m_cache_next].GetSize()) m_cache.Remove(m_cache_keys[m_cache_next]);
+
+  m_cache.Set(key, result);
+  m_cache_keys[m_cache_next] = key;
+  m_cache_next = (m_cache_next + 1) % m_cache_keys.GetSize();
+}
+
+
+cOrganism* cDivideTestQueue::findDeferredOrganism(const sDeferredDivide& deferred)
+{
+  cPopulation& pop = m_world->GetPopulation();
+
+  cPopulationCell& cell = pop.GetCell(deferred.cell_id);
+  if (cell.IsOccupied() && cell.GetOrganism()->GetID() == deferred.org_id) return cell.GetOrganism();
+
+  // The parent may have been moved while it was waiting
+  return pop.GetLiveOrgByID(deferred.org_id);
+}
@@ -0,0 +1,103 @@
+/*
+ *  cDivideTestQueue.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cDivideTestQueue_h
+#define cDivideTestQueue_h
+
+#include "avida/core/Genome.h"
+
+class cAvidaContext;
+class cOrganism;
+class cWorld;
+
+using namespace Avida;
+
+
+// cDivideTestQueue - offspring fitness tests for the REVERT_* and STERILIZE_* mutation modes
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Results are optionally cached by genome (DIVIDE_TEST_CACHE_SIZE), so that repeated mutants are only tested once.
+//  When DIVIDE_TEST_DEFER is set, divides that require a test are held (the parent stops executing) and all of the
+//  genomes collected during an update are tested on the analyze job queue.  The held divides are then completed,
+//  in the order in which they were requested, by ProcessDeferred(), which cPopulation calls as the first step of
+//  ProcessPostUpdate() so that the post-update stats and cell actions see the completed divides.
+
+class cDivideTestQueue
+{
+public:
+  struct sResult
+  {
+    bool is_viable;
+    double fitness;
+    int max_depth;
+    Apto::Array<int> task_counts;
+
+    sResult() : is_viable(false), fitness(0.0), max_depth(0) { ; }
+  };
+
+private:
+  class cTestJob;
+
+  struct sDeferredDivide
+  {
+    int cell_id;
+    int org_id;
+
+    sDeferredDivide() : cell_id(-1), org_id(-1) { ; }
+    sDeferredDivide(int in_cell_id, int in_org_id) : cell_id(in_cell_id), org_id(in_org_id) { ; }
+  };
+
+  cWorld* m_world;
+  bool m_defer;
+
+  Apto::Map<Apto::String, sResult> m_cache;
+  Apto::Array<Apto::String> m_cache_keys;     // ring buffer of cached keys, oldest entry is evicted first
+  int m_cache_next;
+
+  Apto::Map<Apto::String, sResult> m_committed; // results of the batch currently being committed
+  Apto::Array<sDeferredDivide> m_deferred;
+  Apto::Array<Genome> m_deferred_genomes;
+
+
+  cDivideTestQueue(); // @not_implemented
+  cDivideTestQueue(const cDivideTestQueue&); // @not_implemented
+  cDivideTestQueue& operator=(const cDivideTestQueue&); // @not_implemented
+
+public:
+  cDivideTestQueue(cWorld* world);
+  ~cDivideTestQueue() { ; }
+
+  bool IsDeferring() const { return m_defer; }
+  int GetNumDeferred() const { return m_deferred.GetSize(); }
+
+  bool HasResult(const Genome& genome) const;
+  void TestGenome(cAvidaContext& ctx, const Genome& genome, sResult& result);
+
+  void DeferDivide(cOrganism* org);
+  void ProcessDeferred(cAvidaContext& ctx);
+
+private:
+  bool lookupResult(const Apto::String& key, sResult& result) const;
+  void cacheResult(const Apto::String& key, const sResult& result);
+  cOrganism* findDeferredOrganism(const sDeferredDivide& deferred);
+};
+
+#endif
@@ -59,7 +59,7 @@ bool cEventList::AddEvent(eTriggerType trigger, double start, double interval,
   cAction* action = cActionLibrary::GetInstance().Create((const char*)name, m_world, args, feedback);
   
   if (action != NULL) {
-    cEventListEntry* entry = new cEventListEntry(action, name, trigger, start, interval, stop);
+    cEventListEntry* entry = new cEventListEntry(action, name, trigger, start, interval, stop, m_next_sequence++);
     
     // If there are no events in the list yet.
     if (m_tail == NULL) {
@@ -73,6 +73,9 @@ bool cEventList::AddEvent(eTriggerType trigger, double start, double interval,
       m_tail = entry;
     }
     
+    const Apto::String name_key((const char*)name);
+    m_name_counts.Set(name_key, m_name_counts.GetWithDefault(name_key, 0) + 1);
+    
     SyncEvent(entry);
 		
 		if (trigger == BIRTHS_INTERRUPT)  //Operates outside of usual event processing
@@ -121,9 +124,145 @@ void cEventList::Delete(cEventListEntry* entry)
     m_tail = entry->GetPrev();
   }
   
+  dequeueEntry(entry);
+  
+  const Apto::String name_key((const char*)entry->GetName());
+  const int name_count = m_name_counts.GetWithDefault(name_key, 0) - 1;
+  if (name_count > 0) m_name_counts.Set(name_key, name_count);
+  else m_name_counts.Remove(name_key);
+  
   delete entry;
 }
 
+
+void cEventList::queueEntry(cEventListEntry* entry)
+{
+  assert(entry->GetQueuePos() < 0);
+  if (entry->GetTrigger() >= NUM_QUEUED_TRIGGERS) return;
+  
+  Apto::Array<cEventListEntry*, Apto::Smart>& queue = m_queues[entry->GetTrigger()];
+  queue.Push(entry);
+  entry->SetQueuePos(queue.GetSize() - 1);
+  siftQueueUp(queue, queue.GetSize() - 1);
+}
+
+
+void cEventList::dequeueEntry(cEventListEntry* entry)
+{
+  const int pos = entry->GetQueuePos();
+  if (pos < 0) return;
+  
+  Apto::Array<cEventListEntry*, Apto::Smart>& queue = m_queues[entry->GetTrigger()];
+  cEventListEntry* last = queue.Pop();
+  entry->SetQueuePos(-1);
+  if (last == entry) return;
+  
+  queue[pos] = last;
+  last->SetQueuePos(pos);
+  siftQueueUp(queue, pos);
+  siftQueueDown(queue, last->GetQueuePos());
+}
+
+
+// Queued entries are ordered by next trigger value, ties broken by list position
+static inline bool queuedBefore(const double a_key, const int a_seq, const double b_key, const int b_seq)
+{
+  return (a_key < b_key || (a_key == b_key && a_seq < b_seq));
+}
+
+
+void cEventList::siftQueueUp(Apto::Array<cEventListEntry*, Apto::Smart>& queue, int pos)
+{
+  cEventListEntry* entry = queue[pos];
+  const double key = entry->GetQueueKey();
+  while (pos > 0) {
+    const int parent = (pos - 1) / 2;
+    if (!queuedBefore(key, entry->GetSequence(), queue[parent]->GetQueueKey(), queue[parent]->GetSequence())) break;
+    queue[pos] = queue[parent];
+    queue[pos]->SetQueuePos(pos);
+    pos = parent;
+  }
+  queue[pos] = entry;
+  entry->SetQueuePos(pos);
+}
+
+
+void cEventList::siftQueueDown(Apto::Array<cEventListEntry*, Apto::Smart>& queue, int pos)
+{
+  cEventListEntry* entry = queue[pos];
+  const double key = entry->GetQueueKey();
+  const int size = queue.GetSize();
+  while (true) {
+    int child = 2 * pos + 1;
+    if (child >= size) break;
+    if (child + 1 < size && queuedBefore(queue[child + 1]->GetQueueKey(), queue[child + 1]->GetSequence(),
+                                         queue[child]->GetQueueKey(), queue[child]->GetSequence())) {
+      child++;
+    }
+    if (!queuedBefore(queue[child]->GetQueueKey(), queue[child]->GetSequence(), key, entry->GetSequence())) break;
+    queue[pos] = queue[child];
+    queue[pos]->SetQueuePos(pos);
+    pos = child;
+  }
+  queue[pos] = entry;
+  entry->SetQueuePos(pos);
+}
+
+
+// Moves every queued entry whose next trigger value has been reached into the due heap.  Entries at or before
+// last_sequence in the list have already been visited by the current pass, and are held until the pass is done.
+void cEventList::collectDueEntries(int last_sequence)
+{
+  for (int trigger = 0; trigger < NUM_QUEUED_TRIGGERS; trigger++) {
+    Apto::Array<cEventListEntry*, Apto::Smart>& queue = m_queues[trigger];
+    if (queue.GetSize() == 0) continue;
+    
+    // IMMEDIATE events are always due
+    const double t_val = (trigger == IMMEDIATE) ? DBL_MAX : GetTriggerValue((eTriggerType)trigger);
+    while (queue.GetSize() && queue[0]->GetQueueKey() <= t_val) {
+      cEventListEntry* entry = queue[0];
+      dequeueEntry(entry);
+      if (entry->GetSequence() > last_sequence) pushDue(entry);
+      else m_deferred.Push(entry);
+    }
+  }
+}
+
+
+void cEventList::pushDue(cEventListEntry* entry)
+{
+  int pos = m_due.GetSize();
+  m_due.Push(entry);
+  while (pos > 0) {
+    const int parent = (pos - 1) / 2;
+    if (m_due[parent]->GetSequence() < entry->GetSequence()) break;
+    m_due[pos] = m_due[parent];
+    pos = parent;
+  }
+  m_due[pos] = entry;
+}
+
+
+cEventList::cEventListEntry* cEventList::popDue()
+{
+  cEventListEntry* top = m_due[0];
+  cEventListEntry* last = m_due.Pop();
+  const int size = m_due.GetSize();
+  if (size == 0) return top;
+  
+  int pos = 0;
+  while (true) {
+    int child = 2 * pos + 1;
+    if (child >= size) break;
+    if (child + 1 < size && m_due[child + 1]->GetSequence() < m_due[child]->GetSequence()) child++;
+    if (last->GetSequence() < m_due[child]->GetSequence()) break;
+    m_due[pos] = m_due[child];
+    pos = child;
+  }
+  m_due[pos] = last;
+  return top;
+}
+
 double cEventList::GetTriggerValue(eTriggerType trigger) const
 {
   // Returns TRIGGER_END if invalid, TRIGGER_BEGIN for IMMEDIATE
@@ -149,14 +288,18 @@ double cEventList::GetTriggerValue(eTriggerType trigger) const
 }
 
 
+// Events are processed in list order, each at most once per pass, with the trigger value read as the event is
+// reached.  Only the events whose next trigger value has been reached are visited.  Since an action may advance the
+// trigger values (e.g. by injecting organisms), the queues are checked again for later events after each action.
 void cEventList::Process(cAvidaContext& ctx)
 {
   double t_val = 0; // trigger value
   
-  // Iterate through all entrys in event list
-  cEventListEntry* entry = m_head;
-  while (entry != NULL) {
-    cEventListEntry* next_entry = entry->GetNext();
+  collectDueEntries(-1);
+  while (m_due.GetSize()) {
+    cEventListEntry* entry = popDue();
+    const int sequence = entry->GetSequence();
+    bool processed = false;
     
     // Check trigger condition
     
@@ -164,10 +307,9 @@ void cEventList::Process(cAvidaContext& ctx)
     if (entry->GetTrigger() == IMMEDIATE) {
       entry->GetAction()->Process(ctx);
       Delete(entry);
-    } else if (entry->GetTrigger() != BIRTHS_INTERRUPT) {
-      //BIRTHS_INTERRUPT occur outside of update boundaries
-	  //and should not alter the behavior of other events.
-	  
+      entry = NULL;
+      processed = true;
+    } else {
 	  // Get the value of the appropriate trigger varile
       t_val = GetTriggerValue(entry->GetTrigger());
       
@@ -177,6 +319,7 @@ void cEventList::Process(cAvidaContext& ctx)
 
         // Process the Action
         entry->GetAction()->Process(ctx);
+        processed = true;
         
         // Handle Interval Adjustment
         if (entry->GetInterval() == TRIGGER_ALL) {
@@ -193,12 +336,19 @@ void cEventList::Process(cAvidaContext& ctx)
         // If the event can never happen now... excize it
         if (entry != NULL && entry->GetStop() != TRIGGER_END &&
             ((entry->GetStart() > entry->GetStop() && entry->GetInterval() > 0) ||
-             (entry->GetStart() < entry->GetStop() && entry->GetInterval() < 0)))
+             (entry->GetStart() < entry->GetStop() && entry->GetInterval() < 0))) {
             Delete(entry);
+            entry = NULL;
+        }
       }
-    } 
-    entry = next_entry;
+    }
+    
+    if (entry != NULL) m_deferred.Push(entry);
+    if (processed) collectDueEntries(sequence);
   }
+  
+  for (int i = 0; i < m_deferred.GetSize(); i++) queueEntry(m_deferred[i]);
+  m_deferred.Resize(0);
 }
 
 
@@ -274,35 +424,45 @@ void cEventList::Sync()
 }
 
 
-void cEventList::SyncEvent(cEventListEntry* entry)
+// Returns false if the event was removed
+bool cEventList::SyncEvent(cEventListEntry* entry)
 {
   // Ignore events that are immdeiate
-  if (entry->GetTrigger() == IMMEDIATE) return;
+  if (entry->GetTrigger() == IMMEDIATE) {
+    if (entry->GetQueuePos() < 0) queueEntry(entry);
+    return true;
+  }
   
   double t_val = GetTriggerValue(entry->GetTrigger());
   
   // If t_val has past the end, remove (even if it is TRIGGER_ALL)
   if (t_val > entry->GetStop()) {
     Delete(entry);
-    return;
+    return false;
   }
   
   // If it is a trigger once and has passed, remove
   if (t_val > entry->GetStart() && entry->GetInterval() == TRIGGER_ONCE) {
     Delete(entry);
-    return;
+    return false;
   }
   
+  // The start may move, so the entry is requeued under its new trigger value
+  dequeueEntry(entry);
+  
   // If for some reason t_val has been reset or soemthing, rewind
   if (t_val + entry->GetInterval() <= entry->GetStart()) {
     entry->Reset();
   }
   
   // Can't fast forward events that are Triger All
-  if (entry->GetInterval() == TRIGGER_ALL) return;
+  if (entry->GetInterval() != TRIGGER_ALL) {
+    // Keep adding interval to start until we are caught up
+    while (t_val > entry->GetStart()) entry->NextInterval();
+  }
   
-  // Keep adding interval to start until we are caught up
-  while (t_val > entry->GetStart()) entry->NextInterval();
+  queueEntry(entry);
+  return true;
 }
 
 
@@ -475,12 +635,5 @@ bool cEventList::AddEventFileFormat(const cString& in_line, Feedback& feedback)
 /*! Check to see if an event with the given name is upcoming at some point in the future.
  */
 bool cEventList::IsEventUpcoming(const cString& event_name) {
-	cEventListEntry* entry = m_head;
-  while(entry != 0) {
-		if(entry->GetName() == event_name) {
-			return true;
-		}
-		entry = entry->GetNext();
-	}
-	return false;
+	return m_name_counts.Has(Apto::String((const char*)event_name));
 }
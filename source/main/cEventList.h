@@ -29,6 +29,8 @@
 
 #include "tList.h"
 
+#include <cfloat>
+
 
 namespace Avida {
   class Feedback;
@@ -70,28 +72,46 @@ public:
 private:
   class cEventListEntry;  
   
+  // Only events of these triggers (UPDATE through BIRTHS) are processed at update boundaries
+  static const int NUM_QUEUED_TRIGGERS = BIRTHS + 1;
+  
 private:
   cWorld* m_world;
   cEventListEntry* m_head;
   cEventListEntry* m_tail;
   int m_num_events;
+  int m_next_sequence;
+  
+  // Pending events of each update boundary trigger, as binary heaps ordered by next trigger value
+  Apto::Array<cEventListEntry*, Apto::Smart> m_queues[NUM_QUEUED_TRIGGERS];
+  Apto::Array<cEventListEntry*, Apto::Smart> m_due;       // events being processed, as a heap ordered by list position
+  Apto::Array<cEventListEntry*, Apto::Smart> m_deferred;  // events examined during processing, requeued afterwards
+  Apto::Map<Apto::String, int> m_name_counts;
   
   tList<double> m_birth_interrupt_queue;
   
   void QueueBirthInterruptEvent(double t_val);
   void DequeueBirthInterruptEvent(double t_val);
   
-  void SyncEvent(cEventListEntry* event);
+  bool SyncEvent(cEventListEntry* event);
   double GetTriggerValue(eTriggerType trigger) const;
   void Delete(cEventListEntry* entry);
   
+  void queueEntry(cEventListEntry* entry);
+  void dequeueEntry(cEventListEntry* entry);
+  void siftQueueUp(Apto::Array<cEventListEntry*, Apto::Smart>& queue, int pos);
+  void siftQueueDown(Apto::Array<cEventListEntry*, Apto::Smart>& queue, int pos);
+  void collectDueEntries(int last_sequence);
+  void pushDue(cEventListEntry* entry);
+  cEventListEntry* popDue();
+  
   cEventList(); // @not_implemented
   cEventList(const cEventList&); // @not_implemented
   cEventList& operator=(const cEventList&); // @not_implemented
   
   
 public:
-  cEventList(cWorld* world) : m_world(world), m_head(NULL), m_tail(NULL), m_num_events(0) { ; }
+  cEventList(cWorld* world) : m_world(world), m_head(NULL), m_tail(NULL), m_num_events(0), m_next_sequence(0) { ; }
   ~cEventList();
   
   
@@ -146,15 +166,18 @@ private:
     double m_stop;
     double m_original_start;
     
+    int m_sequence;     // position in the list, events added later have higher values
+    int m_queue_pos;    // index in the trigger queue, -1 if not queued
+    
     cEventListEntry* m_prev;
     cEventListEntry* m_next;
     
   public:
     cEventListEntry(cAction* action, const cString& name, eTriggerType trigger = UPDATE, double start = TRIGGER_BEGIN,
-                    double interval = TRIGGER_ONCE, double stop = TRIGGER_END, cEventListEntry* prev = NULL,
-                    cEventListEntry* next = NULL)
+                    double interval = TRIGGER_ONCE, double stop = TRIGGER_END, int sequence = 0,
+                    cEventListEntry* prev = NULL, cEventListEntry* next = NULL)
     : m_action(action), m_name(name), m_trigger(trigger), m_start(start), m_interval(interval), m_stop(stop)
-    , m_original_start(start), m_prev(prev), m_next(next)
+    , m_original_start(start), m_sequence(sequence), m_queue_pos(-1), m_prev(prev), m_next(next)
     {
     }
     
@@ -177,6 +200,12 @@ private:
     double GetInterval() const { return m_interval; }
     double GetStop() const { return m_stop; }
     
+    // The lowest trigger value at which the event may next fire
+    double GetQueueKey() const { return (m_start == TRIGGER_BEGIN) ? -DBL_MAX : m_start; }
+    int GetSequence() const { return m_sequence; }
+    int GetQueuePos() const { return m_queue_pos; }
+    void SetQueuePos(int pos) { m_queue_pos = pos; }
+    
     cEventListEntry* GetPrev() const { return m_prev; }
     cEventListEntry* GetNext() const { return m_next; }
   };
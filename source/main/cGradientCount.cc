@@ -112,6 +112,10 @@ cGradientCount::cGradientCount(cWorld* world, int peakx, int peaky, int height,
   , m_min_usedy(-1)
   , m_max_usedx(-1)
   , m_max_usedy(-1)
+  , m_dirty_min_x(-1)
+  , m_dirty_min_y(-1)
+  , m_dirty_max_x(-1)
+  , m_dirty_max_y(-1)
 {
   ResetGradRes(m_world->GetDefaultContext(), worldx, worldy);
 }
@@ -123,6 +127,37 @@ void cGradientCount::StateAll()
   return;
 }
 
+// Every write from outside of the gradient (organism deposits and consumption through cResourceCount::ModifyCell,
+// SET_CELL_RESOURCE, reinitialization) grows the dirty box, so the refill sweep never skips a cell holding residue
+void cGradientCount::State(int x)
+{
+  cSpatialResCount::State(x);
+  if (x >= 0 && x < GetSize() && Element(x).GetAmount() != 0) markDirty(x % GetX(), x / GetX(), x % GetX(), x / GetX());
+}
+
+void cGradientCount::State(int x, int y)
+{
+  cSpatialResCount::State(x, y);
+  if (x >= 0 && x < GetX() && y >= 0 && y < GetY() && Element(y * GetX() + x).GetAmount() != 0) markDirty(x, y, x, y);
+}
+
+void cGradientCount::SetCellAmount(int cell_id, double res)
+{
+  cSpatialResCount::SetCellAmount(cell_id, res);
+  if (res != 0 && cell_id >= 0 && cell_id < GetSize()) {
+    const int x = cell_id % GetX();
+    const int y = cell_id / GetX();
+    markDirty(x, y, x, y);
+  }
+}
+
+void cGradientCount::ResetResourceCounts()
+{
+  // cells return to the resource and cell initial values, which may leave any of them nonzero
+  cSpatialResCount::ResetResourceCounts();
+  markDirty(0, 0, GetX() - 1, GetY() - 1);
+}
+
 void cGradientCount::UpdateCount(cAvidaContext& ctx)
 { 
   m_old_peakx = m_peakx;
@@ -141,11 +176,12 @@ void cGradientCount::updatePeakRes(cAvidaContext& ctx)
   // to speed things up, we only check cells within the possible spread of the peak
   // and we only need to do this if decay > 1 (if decay == 1, we're going to reset everything regardless of the amount left)
   // if decay = 1 and the resource IS depletable, that means we have a moving depleting resource! Odd, but useful.
-  if (m_decay > 1) {
-    int max_pos_x = min(m_peakx + m_spread + 1, GetX() - 1);
-    int min_pos_x = max(m_peakx - m_spread - 1, 0);
-    int max_pos_y = min(m_peaky + m_spread + 1, GetY() - 1);
-    int min_pos_y = max(m_peaky - m_spread - 1, 0);
+  // cells outside of the dirty box are all 0, so they can never be edible
+  if (m_decay > 1 && m_dirty_min_x != -1) {
+    int max_pos_x = min(min(m_peakx + m_spread + 1, GetX() - 1), m_dirty_max_x);
+    int min_pos_x = max(max(m_peakx - m_spread - 1, 0), m_dirty_min_x);
+    int max_pos_y = min(min(m_peaky + m_spread + 1, GetY() - 1), m_dirty_max_y);
+    int min_pos_y = max(max(m_peaky - m_spread - 1, 0), m_dirty_min_y);
     for (int ii = min_pos_x; ii < max_pos_x + 1; ii++) {
       for (int jj = min_pos_y; jj < max_pos_y + 1; jj++) {
         if (Element(jj * GetX() + ii).GetAmount() >= 1) {
@@ -282,6 +318,31 @@ void cGradientCount::fillinResourceValues()
     max_pos_y = min(m_peaky + m_spread + m_move_speed + 1, GetY() - 1);
     min_pos_y = max(m_peaky - m_spread - m_move_speed - 1, 0);
   }
+  
+  // only cells within the new spread of the peak can take on a nonzero value, and any residue is confined to the 
+  // dirty box, every other cell in the range is 0 already and would be set to 0 again, so the range can be clipped
+  // to the bounding box of the two
+  const int spread_min_x = max(m_peakx - m_spread, 0);
+  const int spread_min_y = max(m_peaky - m_spread, 0);
+  const int spread_max_x = min(m_peakx + m_spread, GetX() - 1);
+  const int spread_max_y = min(m_peaky + m_spread, GetY() - 1);
+  const bool residue_in_range = (m_dirty_min_x == -1) || (m_dirty_min_x >= min_pos_x && m_dirty_max_x <= max_pos_x &&
+                                                          m_dirty_min_y >= min_pos_y && m_dirty_max_y <= max_pos_y);
+  if (m_dirty_min_x == -1) {
+    max_pos_x = min(max_pos_x, spread_max_x);
+    min_pos_x = max(min_pos_x, spread_min_x);
+    max_pos_y = min(max_pos_y, spread_max_y);
+    min_pos_y = max(min_pos_y, spread_min_y);
+  } else {
+    max_pos_x = min(max_pos_x, max(spread_max_x, m_dirty_max_x));
+    min_pos_x = max(min_pos_x, min(spread_min_x, m_dirty_min_x));
+    max_pos_y = min(max_pos_y, max(spread_max_y, m_dirty_max_y));
+    min_pos_y = max(min_pos_y, min(spread_min_y, m_dirty_min_y));
+  }
+  
+  // all residue in range gets overwritten, leaving only the new spread of the peak
+  if (residue_in_range) clearDirty();
+  markDirty(spread_min_x, spread_min_y, spread_max_x, spread_max_y);
 
   if (m_is_plateau_common == 1 && !m_just_reset && m_world->GetStats().GetUpdate() > 0) {
     // with common depletion, new peak height is not the plateau heights, but the delta in plateau heights applied to 
@@ -877,6 +938,7 @@ void cGradientCount::ResetGradRes(cAvidaContext& ctx, int worldx, int worldy)
   
   m_initial = true;
   ResizeClear(worldx, worldy, m_geometry);
+  clearDirty();
   if (m_habitat == 2) {
     generateBarrier(ctx);
   }
@@ -1057,6 +1119,9 @@ void cGradientCount::updateBounds(int x, int y)
   if (y < m_min_usedy || m_min_usedy == -1) m_min_usedy = y;
   if (x > m_max_usedx || m_max_usedx == -1) m_max_usedx = x;
   if (y > m_max_usedy || m_max_usedy == -1) m_max_usedy = y;
+  
+  // every cell the gradient itself gives a value (peaks, barriers, hills, probabilistic patches) is also dirty
+  markDirty(x, y, x, y);
 }
 
 void cGradientCount::resetUsedBounds()
@@ -1066,3 +1131,27 @@ void cGradientCount::resetUsedBounds()
   m_max_usedx = -1;
   m_max_usedy = -1;
 }
+
+void cGradientCount::markDirty(int min_x, int min_y, int max_x, int max_y)
+{
+  if (min_x > max_x || min_y > max_y) return;
+  if (m_dirty_min_x == -1) {
+    m_dirty_min_x = min_x;
+    m_dirty_min_y = min_y;
+    m_dirty_max_x = max_x;
+    m_dirty_max_y = max_y;
+    return;
+  }
+  if (min_x < m_dirty_min_x) m_dirty_min_x = min_x;
+  if (min_y < m_dirty_min_y) m_dirty_min_y = min_y;
+  if (max_x > m_dirty_max_x) m_dirty_max_x = max_x;
+  if (max_y > m_dirty_max_y) m_dirty_max_y = max_y;
+}
+
+void cGradientCount::clearDirty()
+{
+  m_dirty_min_x = -1;
+  m_dirty_min_y = -1;
+  m_dirty_max_x = -1;
+  m_dirty_max_y = -1;
+}
@@ -109,6 +109,12 @@ private:
   int m_min_usedy;
   int m_max_usedx;
   int m_max_usedy;
+  
+  // bounding box of the cells that may hold a nonzero value, every cell outside of it is known to be 0 (-1 if empty)
+  int m_dirty_min_x;
+  int m_dirty_min_y;
+  int m_dirty_max_x;
+  int m_dirty_max_y;
     
 public:
   cGradientCount(cWorld* world, int peakx, int peaky, int height, int spread, double plateau, int decay,              
@@ -121,7 +127,11 @@ public:
   ~cGradientCount();
 
   void UpdateCount(cAvidaContext& ctx);
+  void State(int x);
+  void State(int x, int y);
   void StateAll();
+  void SetCellAmount(int cell_id, double res);
+  void ResetResourceCounts();
   
   void SetGradInitialPlat(double plat_val) { m_initial_plat = plat_val; m_initial = true; }
   void SetGradPeakX(int peakx) { m_peakx = peakx; }
@@ -187,6 +197,8 @@ private:
   void generateHills(cAvidaContext& ctx);    
   void updateBounds(int x, int y);
   void resetUsedBounds();
+  void markDirty(int min_x, int min_y, int max_x, int max_y);
+  void clearDirty();
   void clearExistingProbRes();
 };
 
@@ -0,0 +1,55 @@
+/*
+ *  cNeighborhoodTable.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cNeighborhoodTable.h"
+
+
+void cNeighborhoodTable::Reset(int num_cells)
+{
+  m_num_cells = num_cells;
+  m_level_index = Apto::Map<int, int>();
+  m_levels.Resize(0);
+}
+
+
+cNeighborhoodTable::Span cNeighborhoodTable::Set(int cell_id, int radius, const Apto::Array<int, Apto::Smart>& ids)
+{
+  assert(cell_id >= 0 && cell_id < m_num_cells);
+
+  int level_idx = m_level_index.GetWithDefault(radius, -1);
+  if (level_idx < 0) {
+    level_idx = m_levels.GetSize();
+    m_levels.Resize(level_idx + 1);
+    m_levels[level_idx].start.Resize(m_num_cells);
+    m_levels[level_idx].start.SetAll(-1);
+    m_levels[level_idx].size.Resize(m_num_cells);
+    m_levels[level_idx].size.SetAll(0);
+    m_levels[level_idx].ids.Resize(0);
+    m_level_index.Set(radius, level_idx);
+  }
+
+  Level& level = m_levels[level_idx];
+  level.start[cell_id] = level.ids.GetSize();
+  level.size[cell_id] = ids.GetSize();
+  for (int i = 0; i < ids.GetSize(); i++) level.ids.Push(ids[i]);
+
+  return Span(&level.ids, level.start[cell_id], level.size[cell_id]);
+}
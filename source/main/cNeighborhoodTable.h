@@ -0,0 +1,97 @@
+/*
+ *  cNeighborhoodTable.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cNeighborhoodTable_h
+#define cNeighborhoodTable_h
+
+#include "apto/core/Array.h"
+#include "apto/core/Map.h"
+
+#include <cassert>
+
+
+// cNeighborhoodTable - Cache of the cells within a given radius of each cell, stored as flat lists of cell IDs
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Neighborhoods are computed by the owner and stored one (cell, radius) pair at a time, so only the radii that are
+//  actually requested take up space.  Reset() discards everything, and must be called whenever the underlying
+//  connectivity changes.
+
+class cNeighborhoodTable
+{
+public:
+  class Span
+  {
+  private:
+    const Apto::Array<int, Apto::Smart>* m_ids;
+    int m_start;
+    int m_size;
+
+  public:
+    Span(const Apto::Array<int, Apto::Smart>* ids, int start, int size) : m_ids(ids), m_start(start), m_size(size) { ; }
+
+    inline int GetSize() const { return m_size; }
+    inline int operator[](int idx) const { assert(idx >= 0 && idx < m_size); return (*m_ids)[m_start + idx]; }
+  };
+
+private:
+  struct Level
+  {
+    Apto::Array<int> start;                 // offset of each cell's neighborhood in ids, -1 if not yet computed
+    Apto::Array<int> size;
+    Apto::Array<int, Apto::Smart> ids;
+  };
+
+  int m_num_cells;
+  Apto::Map<int, int> m_level_index;        // radius -> index into m_levels
+  Apto::Array<Level, Apto::ManagedPointer> m_levels;
+
+
+  cNeighborhoodTable(const cNeighborhoodTable&); // @not_implemented
+  cNeighborhoodTable& operator=(const cNeighborhoodTable&); // @not_implemented
+
+public:
+  cNeighborhoodTable() : m_num_cells(0) { ; }
+
+  void Reset(int num_cells);
+
+  inline bool Has(int cell_id, int radius) const;
+  inline Span Get(int cell_id, int radius) const;
+
+  // Stores the neighborhood of cell_id, the IDs are copied in order
+  Span Set(int cell_id, int radius, const Apto::Array<int, Apto::Smart>& ids);
+};
+
+
+inline bool cNeighborhoodTable::Has(int cell_id, int radius) const
+{
+  const int level = m_level_index.GetWithDefault(radius, -1);
+  return (level >= 0 && m_levels[level].start[cell_id] >= 0);
+}
+
+inline cNeighborhoodTable::Span cNeighborhoodTable::Get(int cell_id, int radius) const
+{
+  const Level& level = m_levels[m_level_index.GetWithDefault(radius, -1)];
+  assert(level.start[cell_id] >= 0);
+  return Span(&level.ids, level.start[cell_id], level.size[cell_id]);
+}
+
+#endif
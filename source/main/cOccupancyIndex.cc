@@ -0,0 +1,90 @@
+/*
+ *  cOccupancyIndex.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cOccupancyIndex.h"
+
+#include <cassert>
+
+
+void cOccupancyIndex::Resize(int world_x, int world_y)
+{
+  m_world_x = world_x;
+  m_world_y = world_y;
+  for (int layer = 0; layer < NUM_LAYERS; layer++) {
+    m_counts[layer].ResizeClear(world_x * world_y);
+    m_counts[layer].SetAll(0);
+    m_row_trees[layer].ResizeClear(world_y * (world_x + 1));
+    m_row_trees[layer].SetAll(0);
+    m_col_trees[layer].ResizeClear(world_x * (world_y + 1));
+    m_col_trees[layer].SetAll(0);
+  }
+}
+
+
+void cOccupancyIndex::Add(eLayer layer, int cell_id, int delta)
+{
+  assert(cell_id >= 0 && cell_id < m_counts[layer].GetSize());
+
+  m_counts[layer][cell_id] += delta;
+  assert(m_counts[layer][cell_id] >= 0);
+
+  const int x = cell_id % m_world_x;
+  const int y = cell_id / m_world_x;
+
+  Apto::Array<int>& rows = m_row_trees[layer];
+  const int row_offset = y * (m_world_x + 1);
+  for (int i = x + 1; i <= m_world_x; i += (i & -i)) rows[row_offset + i] += delta;
+
+  Apto::Array<int>& cols = m_col_trees[layer];
+  const int col_offset = x * (m_world_y + 1);
+  for (int i = y + 1; i <= m_world_y; i += (i & -i)) cols[col_offset + i] += delta;
+}
+
+
+// Sum of the first count entries of the tree starting at offset
+inline int cOccupancyIndex::prefixSum(const Apto::Array<int>& trees, int offset, int count)
+{
+  int sum = 0;
+  for (int i = count; i > 0; i -= (i & -i)) sum += trees[offset + i];
+  return sum;
+}
+
+
+int cOccupancyIndex::CountRow(eLayer layer, int y, int x_lo, int x_hi) const
+{
+  assert(y >= 0 && y < m_world_y);
+  assert(x_lo >= 0 && x_hi < m_world_x);
+  if (x_lo > x_hi) return 0;
+
+  const int offset = y * (m_world_x + 1);
+  return prefixSum(m_row_trees[layer], offset, x_hi + 1) - prefixSum(m_row_trees[layer], offset, x_lo);
+}
+
+
+int cOccupancyIndex::CountColumn(eLayer layer, int x, int y_lo, int y_hi) const
+{
+  assert(x >= 0 && x < m_world_x);
+  assert(y_lo >= 0 && y_hi < m_world_y);
+  if (y_lo > y_hi) return 0;
+
+  const int offset = x * (m_world_y + 1);
+  return prefixSum(m_col_trees[layer], offset, y_hi + 1) - prefixSum(m_col_trees[layer], offset, y_lo);
+}
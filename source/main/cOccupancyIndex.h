@@ -0,0 +1,75 @@
+/*
+ *  cOccupancyIndex.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cOccupancyIndex_h
+#define cOccupancyIndex_h
+
+#include "apto/core/Array.h"
+
+
+// cOccupancyIndex - Per cell counts of organisms and avatars, with fast range counts along rows and columns
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Each layer keeps a count for every cell plus a Fenwick tree for every row and every column of the grid, so the
+//  number of occupants in any horizontal or vertical run of cells can be found in O(log n).  Used by cOrgSensor to
+//  skip over empty stretches of the look wedge.
+
+class cOccupancyIndex
+{
+public:
+  enum eLayer {
+    ORGANISMS = 0,  // organisms placed in cells
+    PRED_AVATARS,   // predator (input) avatars
+    PREY_AVATARS,   // prey (output) avatars
+    NUM_LAYERS
+  };
+
+private:
+  int m_world_x;
+  int m_world_y;
+
+  Apto::Array<int> m_counts[NUM_LAYERS];
+  Apto::Array<int> m_row_trees[NUM_LAYERS];  // world_y trees of world_x + 1 entries
+  Apto::Array<int> m_col_trees[NUM_LAYERS];  // world_x trees of world_y + 1 entries
+
+
+  cOccupancyIndex(const cOccupancyIndex&); // @not_implemented
+  cOccupancyIndex& operator=(const cOccupancyIndex&); // @not_implemented
+
+public:
+  cOccupancyIndex() : m_world_x(0), m_world_y(0) { ; }
+
+  // Clears all counts
+  void Resize(int world_x, int world_y);
+
+  void Add(eLayer layer, int cell_id, int delta);
+
+  inline int GetCount(eLayer layer, int cell_id) const { return m_counts[layer][cell_id]; }
+
+  // Occupants of the cells (x_lo..x_hi, y) and (x, y_lo..y_hi), inclusive
+  int CountRow(eLayer layer, int y, int x_lo, int x_hi) const;
+  int CountColumn(eLayer layer, int x, int y_lo, int y_hi) const;
+
+private:
+  static inline int prefixSum(const Apto::Array<int>& trees, int offset, int count);
+};
+
+#endif
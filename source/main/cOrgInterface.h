@@ -61,6 +61,7 @@ public:
   virtual ~cOrgInterface() { ; }
 
   virtual const Apto::Array<cOrganism*, Apto::Smart>& GetLiveOrgList() const = 0;
+  virtual cOrganism* GetLiveOrgByID(int org_id) const = 0;
   virtual int GetCellID() = 0;
   virtual cPopulationCell* GetCell() = 0;
   virtual cPopulationCell* GetCell(int cell_id) = 0;
@@ -24,6 +24,8 @@
 #include "cOrgSensor.h"
 
 #include "cEnvironment.h"
+#include "cOccupancyIndex.h"
+#include "cPopulation.h"
 #include "cPopulationCell.h"  
 #include "cResource.h"
 #include "cResourceCount.h"
@@ -135,15 +137,8 @@ const cOrgSensor::sLookOut cOrgSensor::SetLooking(cAvidaContext& ctx, sLookInit&
     }
     // if valid org id number, does the value represent a living organism
     else if (id_sought != -1) {
-      const Apto::Array<cOrganism*, Apto::Smart> live_orgs = m_organism->GetOrgInterface().GetLiveOrgList();
-      for (int i = 0; i < live_orgs.GetSize(); i++) {  
-        cOrganism* living_org = live_orgs[i];
-        if (id_sought == living_org->GetID()) {
-          target_org = living_org;
-          done_setting_org = true;
-          break;
-        }
-      }
+      target_org = m_organism->GetOrgInterface().GetLiveOrgByID(id_sought);
+      if (target_org) done_setting_org = true;
     }
     // if number didn't represent a living org, we default to WalkCells searching for anybody, skipping FindOrg
     if (!done_setting_org && id_sought != -1) id_sought = -1;    
@@ -355,6 +350,9 @@ cOrgSensor::sLookOut cOrgSensor::WalkCells(cAvidaContext& ctx, const cResourceLi
   
   bool stop_at_first_found = (search_type == 0) || (habitat_used == -2 && (search_type == -1 || search_type == 1));
   
+  // organism searches can use the occupancy index to pass over cells that hold nothing of interest
+  const bool use_occupancy = (habitat_used == -2);
+  
   // Key for facings
   // 7 0 1
   // 6 * 2
@@ -499,9 +497,20 @@ cOrgSensor::sLookOut cOrgSensor::WalkCells(cAvidaContext& ctx, const cResourceLi
       if (!do_right && direction == right) break;
       
       // walk in from the farthest cell on side towards the center
+      int run_start = num_cells_either_side + 1;                         // side cells from here out are known to be occupied
       for (int j = num_cells_either_side; j > 0; j--) {
         bool valid_cell = true;
         this_cell = center_cell + direction * j;
+        if (use_occupancy && j < run_start && TestBounds(this_cell, worldBounds)) {
+          // entering a stretch of in-world side cells, skip all of it if it is empty
+          run_start = sideRunStart(center_cell, direction, worldBounds);
+          if (run_start < 1) run_start = 1;
+          if (countSideOccupants(search_type, center_cell, direction, run_start, j) == 0) {
+            any_valid_side_cells = true;
+            j = run_start;
+            continue;
+          }
+        }
         if (!TestBounds(this_cell, worldBounds) || ((habitat_used != -2 && habitat_used != 3) && !TestBounds(center_cell, tot_bounds))) { 
           // on diagonals...if any side cell is beyond specific parts of world bounds, we can exclude this side for this and any larger distances
           if (diagonal) {
@@ -525,7 +534,14 @@ cOrgSensor::sLookOut cOrgSensor::WalkCells(cAvidaContext& ctx, const cResourceLi
             }
             break;                                       // if not !do_left or !do_right, any cells on this side closer than this to center will be too at this distance, but not greater dist
           }
-          else if (!diagonal) valid_cell = false;        // when not on diagonal, center cell and cells close(r) to center can still be valid even if this side cell is not
+          else if (!diagonal) {
+            valid_cell = false;                          // when not on diagonal, center cell and cells close(r) to center can still be valid even if this side cell is not
+            if (use_occupancy) {
+              // cells are out of the world all the way in to the world edge, resume just inside of it
+              const int run_end = sideRunEnd(center_cell, direction, worldBounds);
+              if (run_end + 1 < j) j = run_end + 1;
+            }
+          }
         }
         else any_valid_side_cells = true;
         
@@ -554,7 +570,10 @@ cOrgSensor::sLookOut cOrgSensor::WalkCells(cAvidaContext& ctx, const cResourceLi
     if (stop_at_first_found && found_edible) break;                             // end side and center searches (found on side)
     
     // work on CENTER cell for this dist
-    if (count_center) {
+    if (count_center && use_occupancy && countOccupants(search_type, center_cell.Y() * worldx + center_cell.X()) == 0) {
+      first_step = false;
+    }
+    else if (count_center) {
       cellResultInfo = TestCell(ctx, resource_lib, habitat_used, search_type, center_cell, val_res, first_step, stop_at_first_found);
       first_step = false;
       if (cellResultInfo.amountFound > 0) {
@@ -971,3 +990,63 @@ int cOrgSensor::FindDistanceFromHome()
   // Otherwise will return distance to here from the 'marked' spot where those instructions were executed.
   return max(abs(m_organism->GetEasterly()), abs(m_organism->GetNortherly()));
 }
+
+
+// Number of organisms/avatars in the cell that an organism search of search_type could report, a cell with no
+// occupants can never produce a sighting, so it does not need to be tested
+int cOrgSensor::countOccupants(const int search_type, const int cell_id)
+{
+  const cOccupancyIndex& occupancy = m_world->GetPopulation().GetOccupancyIndex();
+  if (!m_use_avatar) return occupancy.GetCount(cOccupancyIndex::ORGANISMS, cell_id);
+  
+  int count = 0;
+  if (search_type >= 0) count += occupancy.GetCount(cOccupancyIndex::PRED_AVATARS, cell_id);
+  if (search_type <= 0) count += occupancy.GetCount(cOccupancyIndex::PREY_AVATARS, cell_id);
+  return count;
+}
+
+int cOrgSensor::countSideOccupants(const int search_type, const Apto::Coord<int>& center, const Apto::Coord<int>& dir,
+                                   const int j_lo, const int j_hi)
+{
+  const cOccupancyIndex& occupancy = m_world->GetPopulation().GetOccupancyIndex();
+  
+  // side directions are always along a row or a column
+  const Apto::Coord<int> near_cell = center + dir * j_lo;
+  const Apto::Coord<int> far_cell = center + dir * j_hi;
+  const bool along_row = (dir.X() != 0);
+  const int lo = (along_row) ? min(near_cell.X(), far_cell.X()) : min(near_cell.Y(), far_cell.Y());
+  const int hi = (along_row) ? max(near_cell.X(), far_cell.X()) : max(near_cell.Y(), far_cell.Y());
+  
+  cOccupancyIndex::eLayer layers[cOccupancyIndex::NUM_LAYERS];
+  int num_layers = 0;
+  if (!m_use_avatar) layers[num_layers++] = cOccupancyIndex::ORGANISMS;
+  else {
+    if (search_type >= 0) layers[num_layers++] = cOccupancyIndex::PRED_AVATARS;
+    if (search_type <= 0) layers[num_layers++] = cOccupancyIndex::PREY_AVATARS;
+  }
+  
+  int count = 0;
+  for (int i = 0; i < num_layers; i++) {
+    if (along_row) count += occupancy.CountRow(layers[i], center.Y(), lo, hi);
+    else count += occupancy.CountColumn(layers[i], center.X(), lo, hi);
+  }
+  return count;
+}
+
+// Smallest j at which center + dir * j is inside bounds along the direction of travel (may be < 1)
+int cOrgSensor::sideRunStart(const Apto::Coord<int>& center, const Apto::Coord<int>& dir, sBounds& bounds)
+{
+  if (dir.X() > 0) return bounds.min_x - center.X();
+  if (dir.X() < 0) return center.X() - bounds.max_x;
+  if (dir.Y() > 0) return bounds.min_y - center.Y();
+  return center.Y() - bounds.max_y;
+}
+
+// Largest j at which center + dir * j is inside bounds along the direction of travel
+int cOrgSensor::sideRunEnd(const Apto::Coord<int>& center, const Apto::Coord<int>& dir, sBounds& bounds)
+{
+  if (dir.X() > 0) return bounds.max_x - center.X();
+  if (dir.X() < 0) return center.X() - bounds.min_x;
+  if (dir.Y() > 0) return bounds.max_y - center.Y();
+  return center.Y() - bounds.min_y;
+}
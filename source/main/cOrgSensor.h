@@ -112,6 +112,14 @@ class cOrgSensor
   
   int FindDirFromHome();
   int FindDistanceFromHome();
+  
+private:
+  // Occupancy index helpers for organism searches, side cells are center + dir * j for j in [j_lo, j_hi]
+  int countOccupants(const int search_type, const int cell_id);
+  int countSideOccupants(const int search_type, const Apto::Coord<int>& center, const Apto::Coord<int>& dir,
+                         const int j_lo, const int j_hi);
+  int sideRunStart(const Apto::Coord<int>& center, const Apto::Coord<int>& dir, sBounds& bounds);
+  int sideRunEnd(const Apto::Coord<int>& center, const Apto::Coord<int>& dir, sBounds& bounds);
 };
 
 inline bool cOrgSensor::TestBounds(const Apto::Coord<int>& cell_id, sBounds& bounds)
@@ -80,9 +80,25 @@ public:
   virtual ~OrgPropRetrievalContainer() { ; }
   
   virtual const Property& Get(cOrganism*, const cOrganism::OrgPropertyMap*) const = 0;
+  
+  virtual double GetDouble(cOrganism*) const = 0;
+  virtual int GetInt(cOrganism*) const = 0;
+  virtual Apto::String GetString(cOrganism*) const = 0;
 };
 
 
+// Conversions used by the typed property accessors
+static inline double propAsDouble(int value) { return value; }
+static inline double propAsDouble(double value) { return value; }
+static inline double propAsDouble(const Apto::String& value) { return (double)Apto::StrAs(value); }
+static inline int propAsInt(int value) { return value; }
+static inline int propAsInt(double value) { return static_cast<int>(value); }
+static inline int propAsInt(const Apto::String& value) { return (int)Apto::StrAs(value); }
+static inline Apto::String propAsString(int value) { return Apto::AsStr(value); }
+static inline Apto::String propAsString(double value) { return Apto::AsStr(value); }
+static inline Apto::String propAsString(const Apto::String& value) { return value; }
+
+
 // OrgPropOfType - concrete implementations of OrgPropRetrievalContainer for each necessary type
 // --------------------------------------------------------------------------------------------------------------
 
@@ -101,6 +117,10 @@ public:
   {
     return prop_map->SetTempProp(m_prop_id, (org->*m_fun)());
   }
+  
+  double GetDouble(cOrganism* org) const { return propAsDouble((org->*m_fun)()); }
+  int GetInt(cOrganism* org) const { return propAsInt((org->*m_fun)()); }
+  Apto::String GetString(cOrganism* org) const { return propAsString((org->*m_fun)()); }
 };
 
 
@@ -109,13 +129,18 @@ public:
 
 struct OrgGlobalPropMap
 {
-  Apto::Map<Apto::String, OrgPropRetrievalContainer*> prop_map;
+  Apto::Map<Apto::String, int> handles;               // property ID -> handle, an index into props
+  Apto::Array<OrgPropRetrievalContainer*> props;
   
   ~OrgGlobalPropMap()
   {
-    for (Apto::Map<Apto::String, OrgPropRetrievalContainer*>::ValueIterator it = prop_map.Values(); it.Next();) {
-      delete *it.Get();
-    }
+    for (int i = 0; i < props.GetSize(); i++) delete props[i];
+  }
+  
+  void Define(const Apto::String& prop_id, OrgPropRetrievalContainer* prop)
+  {
+    handles.Set(prop_id, props.GetSize());
+    props.Push(prop);
   }
 };
 
@@ -128,7 +153,7 @@ typedef Apto::SingletonHolder<OrgGlobalPropMap, Apto::CreateWithNew, Apto::Destr
 void cOrganism::Initialize()
 {
 #define DEFINE_PROP(NAME, TYPE, FUNCTION, DESC) s_prop_desc_map.Set(s_prop_name_ ## NAME, DESC); \
-  OrgGlobalPropMapSingleton::Instance().prop_map.Set(s_prop_name_ ## NAME, new OrgPropOfType<TYPE>(s_prop_name_ ## NAME, &cOrganism::FUNCTION));
+  OrgGlobalPropMapSingleton::Instance().Define(s_prop_name_ ## NAME, new OrgPropOfType<TYPE>(s_prop_name_ ## NAME, &cOrganism::FUNCTION));
   DEFINE_PROP(genome, Apto::String, getGenomeString, "Genome");
   DEFINE_PROP(src_transmission_type, int, getSrcTransmissionType, "Source Transmission Type");
   DEFINE_PROP(age, int, getAge, "Age");
@@ -155,6 +180,8 @@ cOrganism::cOrganism(cWorld* world, cAvidaContext& ctx, const Genome& genome, in
   , m_lineage_label(-1)
   , m_lineage(NULL)
   , m_org_list_index(-1)
+  , m_age_stamp(0)
+  , m_age_index_pos(-1)
   , m_org_display(NULL)
   , m_queued_display_data(NULL)
   , m_display(false)
@@ -172,6 +199,7 @@ cOrganism::cOrganism(cWorld* world, cAvidaContext& ctx, const Genome& genome, in
   , m_is_running(false)
   , m_is_sleeping(false)
   , m_is_dead(false)
+  , m_divide_test_pending(false)
   , killed_event(false)
   , m_msg(0)
   , m_opinion(0)
@@ -1581,6 +1609,31 @@ bool cOrganism::MoveAV(cAvidaContext& ctx)
 
 
 
+// cOrganism typed property accessors
+// --------------------------------------------------------------------------------------------------------------
+
+int cOrganism::PropertyHandle(const PropertyID& p_id)
+{
+  return OrgGlobalPropMapSingleton::Instance().handles.GetWithDefault(p_id, -1);
+}
+
+double cOrganism::PropertyAsDouble(int handle)
+{
+  return OrgGlobalPropMapSingleton::Instance().props[handle]->GetDouble(this);
+}
+
+int cOrganism::PropertyAsInt(int handle)
+{
+  return OrgGlobalPropMapSingleton::Instance().props[handle]->GetInt(this);
+}
+
+Apto::String cOrganism::PropertyAsString(int handle)
+{
+  return OrgGlobalPropMapSingleton::Instance().props[handle]->GetString(this);
+}
+
+
+
 // cOrganism::OrgPropertyMap implementation
 // --------------------------------------------------------------------------------------------------------------
 
@@ -1590,20 +1643,18 @@ cOrganism::OrgPropertyMap::~OrgPropertyMap() { ; }
 
 int cOrganism::OrgPropertyMap::GetSize() const
 {
-  return OrgGlobalPropMapSingleton::Instance().prop_map.GetSize();
+  return OrgGlobalPropMapSingleton::Instance().props.GetSize();
 }
 
 bool cOrganism::OrgPropertyMap::Has(const PropertyID& p_id) const
 {
-  return OrgGlobalPropMapSingleton::Instance().prop_map.Has(p_id);
+  return OrgGlobalPropMapSingleton::Instance().handles.Has(p_id);
 }
 
 const Avida::Property& cOrganism::OrgPropertyMap::Get(const PropertyID& p_id) const
 {
-  OrgPropRetrievalContainer* container = NULL;
-  if (OrgGlobalPropMapSingleton::Instance().prop_map.Get(p_id, container)) {
-    return container->Get(m_organism, this);
-  }
+  const int handle = cOrganism::PropertyHandle(p_id);
+  if (handle >= 0) return OrgGlobalPropMapSingleton::Instance().props[handle]->Get(m_organism, this);
 
   return *s_default_prop;
 }
@@ -1618,7 +1669,7 @@ bool cOrganism::OrgPropertyMap::operator==(const PropertyMap& p) const
 {
   // Build distinct key sets
   Apto::Set<PropertyID> pm1pids, pm2pids;
-  Apto::Map<PropertyID, OrgPropRetrievalContainer*>::KeyIterator it = OrgGlobalPropMapSingleton::Instance().prop_map.Keys();
+  Apto::Map<PropertyID, int>::KeyIterator it = OrgGlobalPropMapSingleton::Instance().handles.Keys();
   while (it.Next()) pm1pids.Insert(*it.Get());
   
   PropertyIDSet::ConstIterator pidit = p.PropertyIDs()->Begin();
@@ -1628,14 +1679,11 @@ bool cOrganism::OrgPropertyMap::operator==(const PropertyMap& p) const
   if (pm1pids != pm2pids) return false;
   
   // Compare values
-  it = OrgGlobalPropMapSingleton::Instance().prop_map.Keys();
+  it = OrgGlobalPropMapSingleton::Instance().handles.Keys();
   while (it.Next()) {
-    OrgPropRetrievalContainer* container = NULL;
-    if (OrgGlobalPropMapSingleton::Instance().prop_map.Get(*it.Get(), container)) {
-      if (container->Get(m_organism, this) != p.Get(*it.Get())) return false;
-    } else {
-      return false;
-    }
+    const int handle = cOrganism::PropertyHandle(*it.Get());
+    if (handle < 0) return false;
+    if (OrgGlobalPropMapSingleton::Instance().props[handle]->Get(m_organism, this) != p.Get(*it.Get())) return false;
   }
   
   return true;
@@ -1648,7 +1696,7 @@ Avida::ConstPropertyIDSetPtr cOrganism::OrgPropertyMap::PropertyIDs() const
 {
   PropertyIDSetPtr pidset(new PropertyIDSet);
   
-  Apto::Map<PropertyID, OrgPropRetrievalContainer*>::KeyIterator it = OrgGlobalPropMapSingleton::Instance().prop_map.Keys();
+  Apto::Map<PropertyID, int>::KeyIterator it = OrgGlobalPropMapSingleton::Instance().handles.Keys();
   while (it.Next()) pidset->Insert(*it.Get());
   
   return pidset;
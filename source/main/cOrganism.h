@@ -76,6 +76,8 @@ private:
   int cclade_id;				                  // @MRR Coalescence clade information (set in cPopulation)
 
   int m_org_list_index;
+  int m_age_stamp;                        // cAgeIndex bucket and position, maintained by the index
+  int m_age_index_pos;
   
   sOrgDisplay* m_org_display;
   sOrgDisplay* m_queued_display_data;
@@ -105,6 +107,7 @@ private:
   bool m_is_running;       // Does this organism have the CPU?
   bool m_is_sleeping;      // Is this organism sleeping?
   bool m_is_dead;          // Is this organism dead?
+  bool m_divide_test_pending; // Is a divide held waiting on its offspring test? (see cDivideTestQueue)
 
   bool killed_event;
 
@@ -125,6 +128,15 @@ public:
   
   const PropertyMap& Properties() const;
   
+  // Interned property handles and typed accessors, which skip the ID lookup and the temporary Property of
+  // Properties().Get().  Handles are resolved once with PropertyHandle(), which returns -1 for unknown properties.
+  // Only code that knows it holds a cOrganism can use them (currently the viewer map modes), consumers of the generic
+  // Systematics::Unit interface such as Genotype::HandleUnitGestation still go through Properties().
+  static int PropertyHandle(const PropertyID& p_id);
+  double PropertyAsDouble(int handle);
+  int PropertyAsInt(int handle);
+  Apto::String PropertyAsString(int handle);
+  
 
   // --------  Support Methods  --------
   inline double GetTestFitness(cAvidaContext& ctx) const;
@@ -185,6 +197,9 @@ public:
 
   bool IsDead() { return m_is_dead; }
 
+  void SetDivideTestPending(bool in_pending) { m_divide_test_pending = in_pending; }
+  bool IsDivideTestPending() const { return m_divide_test_pending; }
+
   bool IsInterrupted();
 
   bool GetPheromoneStatus() { return m_pher_drop; }
@@ -200,6 +215,9 @@ public:
 
   inline void SetOrgIndex(int index) { m_org_list_index = index; }
   inline int GetOrgIndex() { return m_org_list_index; }
+  inline void SetAgeIndexPos(int stamp, int pos) { m_age_stamp = stamp; m_age_index_pos = pos; }
+  inline int GetAgeStamp() const { return m_age_stamp; }
+  inline int GetAgeIndexPos() const { return m_age_index_pos; }
   
   // Org displaying
   inline void ActivateDisplay() { m_display = true; }
@@ -20,13 +20,21 @@
  */
 
 #include "cPhenPlastGenotype.h"
+
+#include "apto/rng.h"
+
 #include "cPhenPlastSummary.h"
+#include "cTestCPUBatch.h"
 #include <iostream>
 #include <cmath>
 #include <cfloat>
 
 const Apto::String cPhenPlastSummary::ObjectKey("cPhenPlastSummary");
 
+// Trials are tested in blocks of about this size, bounding the number of test organisms alive at once
+static const int TRIAL_BLOCK_SIZE = 1024;
+
+
 cPhenPlastGenotype::cPhenPlastGenotype(const Genome& in_genome, int num_trials, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx)
 : m_genome(in_genome), m_num_trials(num_trials), m_world(world)
 {
@@ -36,6 +44,13 @@ cPhenPlastGenotype::cPhenPlastGenotype(const Genome& in_genome, int num_trials,
   Process(test_info, world, ctx);
 }
 
+cPhenPlastGenotype::cPhenPlastGenotype(const Genome& in_genome, int num_trials, cTestCPUBatch& batch, int first_result, cWorld* world)
+: m_genome(in_genome), m_num_trials(num_trials), m_world(world)
+{
+  for (int k = 0; k < num_trials; k++) AddTrial(batch.GetResult(first_result + k));
+  Summarize(world);
+}
+
 cPhenPlastGenotype::~cPhenPlastGenotype()
 {
   tListIterator<cPlasticPhenotype> ppit(m_plastic_phenotypes);
@@ -45,28 +60,98 @@ cPhenPlastGenotype::~cPhenPlastGenotype()
   }
 }
 
-void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx)
+// In a parallel batch each genome draws a single seed from the context, and the seeds of its trials are drawn in order
+// from a stream seeded with it.  A genome's trials are thus independent of how they are blocked, of the thread count,
+// and of whether the genome is tested alone or as part of a list.  A serial batch tests the trials in order on the
+// context itself, so no seeds are drawn and the results are those of testing each trial in turn.
+
+void cPhenPlastGenotype::QueueTrials(cTestCPUBatch& batch, const Genome& genome, int num_trials, cAvidaContext& ctx)
 {
-  cTestCPU* test_cpu = m_world->GetHardwareManager().CreateTestCPU(ctx);
+  if (!batch.IsParallel()) {
+    queueTrials(batch, genome, num_trials, NULL);
+    return;
+  }
+  
+  Apto::RNG::AvidaRNG trial_rng(ctx.GetRandom().GetInt(ctx.GetRandom().MaxSeed()));
+  queueTrials(batch, genome, num_trials, &trial_rng);
+}
 
-  if (m_num_trials > 1) test_info.UseRandomInputs(true);
+void cPhenPlastGenotype::queueTrials(cTestCPUBatch& batch, const Genome& genome, int num_trials, Apto::Random* trial_rng)
+{
+  for (int k = 0; k < num_trials; k++) {
+    if (trial_rng) batch.AddGenome(genome, trial_rng->GetInt(trial_rng->MaxSeed()));
+    else batch.AddGenome(genome);
+  }
+}
+
+void cPhenPlastGenotype::TestGenomes(const Apto::Array<Genome>& genomes, int num_trials, cCPUTestInfo& test_info,
+                                     cWorld* world, cAvidaContext& ctx, Apto::Array<Apto::SmartPtr<cPhenPlastGenotype> >& results)
+{
+  if (num_trials > 1) test_info.UseRandomInputs(true);
   
-  for (int k = 0; k < m_num_trials; k++){
-    test_cpu->TestGenome(ctx, test_info, m_genome);
-    //Is this a new phenotype?
-    UniquePhenotypes::iterator uit = m_unique.find(&test_info.GetTestPhenotype());
-    if (uit == m_unique.end()){  // Yes, make a new entry for it
-      cPlasticPhenotype* new_phen = new cPlasticPhenotype(test_info, m_num_trials);
-      m_plastic_phenotypes.Push(new_phen);
-      m_unique.insert( static_cast<cPhenotype*>(new_phen) );
-    } else{   // No, add an observation to existing entry, make sure it is equivalent
-      if (!static_cast<cPlasticPhenotype*>((*uit))->AddObservation(test_info)){
-        cerr << "Error with this plastic phenotype. Abort." << endl;
-        exit(3);
-      }
+  results.Resize(genomes.GetSize());
+  cTestCPUBatch batch(world, test_info);
+  int next = 0;
+  while (next < genomes.GetSize()) {
+    // Genomes with too many trials to share a block are tested on their own
+    if (num_trials > TRIAL_BLOCK_SIZE) {
+      results[next] = Apto::SmartPtr<cPhenPlastGenotype>(new cPhenPlastGenotype(genomes[next], num_trials, test_info, world, ctx));
+      next++;
+      continue;
+    }
+    
+    // Otherwise the trials of as many genomes as fit in a block are tested together
+    const int first = next;
+    batch.Clear();
+    for (; next < genomes.GetSize() && batch.GetSize() + num_trials <= TRIAL_BLOCK_SIZE; next++) {
+      QueueTrials(batch, genomes[next], num_trials, ctx);
+    }
+    batch.Run(ctx);
+    
+    for (int i = first; i < next; i++) {
+      results[i] = Apto::SmartPtr<cPhenPlastGenotype>(new cPhenPlastGenotype(genomes[i], num_trials, batch, (i - first) * num_trials, world));
     }
   }
+}
+
+
+void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx)
+{
+  if (m_num_trials > 1) test_info.UseRandomInputs(true);
+  
+  cTestCPUBatch batch(world, test_info);
+  Apto::Random* trial_rng = NULL;
+  if (batch.IsParallel()) trial_rng = new Apto::RNG::AvidaRNG(ctx.GetRandom().GetInt(ctx.GetRandom().MaxSeed()));
+  for (int first = 0; first < m_num_trials; first += TRIAL_BLOCK_SIZE) {
+    const int num_block = Apto::Min(TRIAL_BLOCK_SIZE, m_num_trials - first);
+    queueTrials(batch, m_genome, num_block, trial_rng);
+    batch.Run(ctx);
+    for (int k = 0; k < num_block; k++) AddTrial(batch.GetResult(k));
+    batch.Clear();
+  }
+  delete trial_rng;
   
+  Summarize(world);
+}
+
+void cPhenPlastGenotype::AddTrial(cCPUTestInfo& test_info)
+{
+  //Is this a new phenotype?
+  UniquePhenotypes::iterator uit = m_unique.find(&test_info.GetTestPhenotype());
+  if (uit == m_unique.end()){  // Yes, make a new entry for it
+    cPlasticPhenotype* new_phen = new cPlasticPhenotype(test_info, m_num_trials);
+    m_plastic_phenotypes.Push(new_phen);
+    m_unique.insert( static_cast<cPhenotype*>(new_phen) );
+  } else{   // No, add an observation to existing entry, make sure it is equivalent
+    if (!static_cast<cPlasticPhenotype*>((*uit))->AddObservation(test_info)){
+      cerr << "Error with this plastic phenotype. Abort." << endl;
+      exit(3);
+    }
+  }
+}
+
+void cPhenPlastGenotype::Summarize(cWorld* world)
+{
   // Update statistics
   UniquePhenotypes::iterator uit = m_unique.begin();
   int num_tasks = world->GetEnvironment().GetNumTasks();
@@ -105,8 +190,6 @@ void cPhenPlastGenotype::Process(cCPUTestInfo& test_info, cWorld* world, cAvidaC
     m_viable_probability += (this_phen->IsViable() > 0) ? freq : 0;
     ++uit;
   }
-  
-  if (test_cpu) delete test_cpu;
 }
 
 
@@ -38,6 +38,7 @@
 
 class cAvidaContext;
 class cTestCPU;
+class cTestCPUBatch;
 class cWorld;
 class cEnvironment;
 
@@ -70,10 +71,23 @@ private:
     
   
   void Process(cCPUTestInfo& test_info, cWorld* world, cAvidaContext& ctx);
+  void AddTrial(cCPUTestInfo& test_info);
+  void Summarize(cWorld* world);
+  static void queueTrials(cTestCPUBatch& batch, const Genome& genome, int num_trials, Apto::Random* trial_rng);
   
 public:
   cPhenPlastGenotype(const Genome& in_genome, int num_trails, cCPUTestInfo& test_info,  cWorld* world, cAvidaContext& ctx);
+  
+  // Collects the trials from results [first_result, first_result + num_trials) of a batch that has already been run
+  cPhenPlastGenotype(const Genome& in_genome, int num_trials, cTestCPUBatch& batch, int first_result, cWorld* world);
   ~cPhenPlastGenotype();
+  
+  // Queues the trials of a genome on a batch, with seeds derived from a single draw on ctx if the batch is parallel
+  static void QueueTrials(cTestCPUBatch& batch, const Genome& genome, int num_trials, cAvidaContext& ctx);
+  
+  // Tests each genome in turn, giving the same results as constructing a cPhenPlastGenotype for each in list order
+  static void TestGenomes(const Apto::Array<Genome>& genomes, int num_trials, cCPUTestInfo& test_info,
+                          cWorld* world, cAvidaContext& ctx, Apto::Array<Apto::SmartPtr<cPhenPlastGenotype> >& results);
     
   // Accessors
   int    GetNumPhenotypes() const     { return m_unique.size();  }
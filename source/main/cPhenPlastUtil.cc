@@ -21,7 +21,9 @@
 
 #include "cPhenPlastUtil.h"
 
+#include "avida/systematics/Arbiter.h"
 #include "avida/systematics/Group.h"
+#include "avida/systematics/Manager.h"
 
 #include "cPhenPlastGenotype.h"
 #include "cPhenPlastSummary.h"
@@ -82,3 +84,26 @@ cPhenPlastSummary* cPhenPlastUtil::TestPlasticity(cAvidaContext& ctx, cWorld* wo
   cPhenPlastGenotype pp(mg, world->GetConfig().GENOTYPE_PHENPLAST_CALC.Get(), test_info, world, ctx);
   return new cPhenPlastSummary(pp);
 }
+
+// Tests every genotype that has no summary yet together, in the order the genotype arbiter lists them.  This attaches
+// the same summaries the accessors above would compute one genotype at a time while walking that same list.
+void cPhenPlastUtil::TestPopulation(cAvidaContext& ctx, cWorld* world)
+{
+  Systematics::ManagerPtr classmgr = Systematics::Manager::Of(world->GetNewWorld());
+  Systematics::Arbiter::IteratorPtr it = classmgr->ArbiterForRole("genotype")->Begin();
+  Apto::Array<Systematics::GroupPtr> groups;
+  Apto::Array<Genome> genomes;
+  while (it->Next()) {
+    Systematics::GroupPtr bg = it->Get();
+    if (bg->GetData<cPhenPlastSummary>()) continue;
+    groups.Push(bg);
+    genomes.Push(Genome(bg->Properties().Get("genome")));
+  }
+  
+  cCPUTestInfo test_info;
+  Apto::Array<Apto::SmartPtr<cPhenPlastGenotype> > ppgens;
+  cPhenPlastGenotype::TestGenomes(genomes, world->GetConfig().GENOTYPE_PHENPLAST_CALC.Get(), test_info, world, ctx, ppgens);
+  for (int i = 0; i < groups.GetSize(); i++) {
+    groups[i]->AttachData(Apto::SmartPtr<cPhenPlastSummary>(new cPhenPlastSummary(*ppgens[i])));
+  }
+}
@@ -43,6 +43,9 @@ public:
   static double GetTaskProbability(cAvidaContext& ctx, cWorld* world, Systematics::GroupPtr bg, int task_id);
   static const Apto::Array<double>& GetTaskProbabilities(cAvidaContext& ctx, cWorld* world, Systematics::GroupPtr bg);
   static cPhenPlastSummary* TestPlasticity(cAvidaContext& ctx, cWorld* world, const Genome& mg);
+  
+  // Computes the missing summaries of all genotypes at once, spreading the trials over the analyze job queue
+  static void TestPopulation(cAvidaContext& ctx, cWorld* world);
 };  
 
 
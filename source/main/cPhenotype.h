@@ -486,6 +486,7 @@ public:
 
   int GetGeneration() const { return generation; }
   int GetCPUCyclesUsed() const { assert(initialized == true); return cpu_cycles_used; }
+  int GetLastCPUCyclesUsed() const { assert(initialized == true); return last_cpu_cycles_used; }
   int GetTimeUsed()   const { assert(initialized == true); return time_used; }
   int GetNumExecs() const { assert(initialized == true); return num_execs; }
   int GetTrialTimeUsed()   const { assert(initialized == true); return trial_time_used; }
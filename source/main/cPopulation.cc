@@ -56,12 +56,14 @@
 #include "cParasite.h"
 #include "cPhenotype.h"
 #include "cPopulationCell.h"
+#include "cProfiler.h"
 #include "cResource.h"
 #include "cResourceCount.h"
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cTopology.h"
 #include "cWorld.h"
+#include "tAnalyzeJobBatch.h"
 
 #include "cHardwareCPU.h"
 
@@ -180,6 +182,8 @@ cPopulation::cPopulation(cWorld* world)
 : m_world(world)
 , m_scheduler(NULL)
 , birth_chamber(world)
+, m_divide_tests(world)
+, m_profiler(world->GetProfiler().IsEnabled() ? &world->GetProfiler() : NULL)
 , print_mini_trace_genomes(false)
 , use_micro_traces(false)
 , m_next_prey_q(0)
@@ -190,6 +194,7 @@ cPopulation::cPopulation(cWorld* world)
 , num_pred_organisms(0)
 , num_top_pred_organisms(0)
 , m_has_predatory_res(false)
+, m_neighborhood_mark(0)
 , sync_events(false)
 , m_hgt_resid(-1)
 {
@@ -244,6 +249,7 @@ void cPopulation::SetupCellGrid()
   
   // Allocate the cells, resources, and market.
   cell_array.ResizeClear(num_cells);
+  m_step_state.Resize(num_cells);
   empty_cell_id_array.ResizeClear(cell_array.GetSize());
   for (int i = 0; i < empty_cell_id_array.GetSize(); i++) {
     empty_cell_id_array[i] = i;
@@ -272,6 +278,7 @@ void cPopulation::SetupCellGrid()
       int cell_id = deme_id * deme_size + offset;
       deme_cells[offset] = cell_id;
       cell_array[cell_id].SetDemeID(deme_id);
+      m_step_state.SetDemeID(cell_id, deme_id);
     }
     deme_array[deme_id].Setup(deme_id, deme_cells, deme_size_x, m_world);
   }
@@ -313,6 +320,12 @@ void cPopulation::SetupCellGrid()
   
   BuildTimeSlicer();
   
+  m_cell_neighborhoods.Reset(num_cells);
+  m_deme_neighborhoods.Reset(deme_size);
+  m_neighborhood_marks.Resize(num_cells);
+  m_neighborhood_marks.SetAll(0);
+  m_occupancy.Resize(world_x, world_y);
+  
   
   // Setup the resources...
   const cResourceLib& resource_lib = environment.GetResourceLib();
@@ -531,6 +544,7 @@ inline void cPopulation::AdjustSchedule(const cPopulationCell& cell, const cMeri
 bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_genome, cOrganism* parent_organism)
 {
   assert(parent_organism != NULL);
+  const cInstProfile::Cycles birth_start = (m_profiler) ? cInstProfile::ReadCycles() : 0;
   bool is_doomed = false;
   int doomed_cell = (world_x * world_y) - 1; //Also at the end of cPopulation::ActivateOrganism
   Apto::Array<cOrganism*> offspring_array;
@@ -767,6 +781,8 @@ bool cPopulation::ActivateOffspring(cAvidaContext& ctx, const Genome& offspring_
       delete offspring_array[i];
     }
   }
+  
+  if (m_profiler) m_profiler->AddPhaseCycles(cProfiler::PHASE_BIRTHS, cInstProfile::ReadCycles() - birth_start);
   return parent_alive;
 }
 
@@ -1072,6 +1088,7 @@ bool cPopulation::ActivateOrganism(cAvidaContext& ctx, cOrganism* in_organism, c
   assert(in_organism != NULL);
   
   in_organism->SetOrgInterface(ctx, new cPopulationInterface(m_world));
+  if (m_profiler) in_organism->GetHardware().SetInstProfile(m_profiler->GetInstProfile(&in_organism->GetHardware().GetInstSet()));
   
   // Update the contents of the target cell.
   KillOrganism(target_cell, ctx); 
@@ -1873,16 +1890,20 @@ void cPopulation::KillRandPred(cAvidaContext& ctx, cOrganism* org)
 {
   cOrganism* org_to_kill = org;
   const Apto::Array<cOrganism*, Apto::Smart>& live_org_list = GetLiveOrgList();
-  Apto::Array<cOrganism*> TriedIdx(live_org_list.GetSize());
-  int list_size = TriedIdx.GetSize();
-  for (int i = 0; i < list_size; i ++) { TriedIdx[i] = live_org_list[i]; }
+  // Ruled out organisms are swapped past the end of the candidate range, only the swapped slots are recorded
+  Apto::Map<int, cOrganism*> tried;
+  int list_size = live_org_list.GetSize();
   
   int idx = m_world->GetRandom().GetUInt(list_size);
   while (org_to_kill == org) {
-    cOrganism* org_at = TriedIdx[idx];
+    cOrganism* org_at = tried.GetWithDefault(idx, live_org_list[idx]);
     // exclude prey
     if (org_at->GetParentFT() <= -2 || org_at->GetForageTarget() <= -2) org_to_kill = org_at;
-    else TriedIdx.Swap(idx, --list_size);
+    else {
+      list_size--;
+      tried.Set(idx, tried.GetWithDefault(list_size, live_org_list[list_size]));
+      tried.Set(list_size, org_at);
+    }
     if (list_size == 1) break;
     idx = m_world->GetRandom().GetUInt(list_size);
   }
@@ -1893,16 +1914,20 @@ void cPopulation::KillRandPrey(cAvidaContext& ctx, cOrganism* org)
 {
   cOrganism* org_to_kill = org;
   const Apto::Array<cOrganism*, Apto::Smart>& live_org_list = GetLiveOrgList();
-  Apto::Array<cOrganism*> TriedIdx(live_org_list.GetSize());
-  int list_size = TriedIdx.GetSize();
-  for (int i = 0; i < list_size; i ++) { TriedIdx[i] = live_org_list[i]; }
+  // Ruled out organisms are swapped past the end of the candidate range, only the swapped slots are recorded
+  Apto::Map<int, cOrganism*> tried;
+  int list_size = live_org_list.GetSize();
   
   int idx = m_world->GetRandom().GetUInt(list_size);
   while (org_to_kill == org) {
-    cOrganism* org_at = TriedIdx[idx];
+    cOrganism* org_at = tried.GetWithDefault(idx, live_org_list[idx]);
     // exclude predators and juvenilles with predatory parents (include juvs with non-predatory parents)
     if (org_at->GetForageTarget() > -1 || (org_at->GetForageTarget() == -1 && org_at->GetParentFT() > -2)) org_to_kill = org_at;
-    else TriedIdx.Swap(idx, --list_size);
+    else {
+      list_size--;
+      tried.Set(idx, tried.GetWithDefault(list_size, live_org_list[list_size]));
+      tried.Set(list_size, org_at);
+    }
     if (list_size == 1) break;
     idx = m_world->GetRandom().GetUInt(list_size);
   }
@@ -2050,6 +2075,183 @@ void cPopulation::SwapCells(int cell_id1, int cell_id2, cAvidaContext& ctx)
   
 }
 
+
+// Breadth first walk over the connection lists, each neighborhood is computed once and then served from the table
+cNeighborhoodTable::Span cPopulation::GetCellNeighborhood(int cell_id, int depth)
+{
+  if (depth < 1) depth = 1; // The directly connected cells are always included
+  if (m_cell_neighborhoods.Has(cell_id, depth)) return m_cell_neighborhoods.Get(cell_id, depth);
+  
+  if (++m_neighborhood_mark == INT_MAX) {
+    m_neighborhood_marks.SetAll(0);
+    m_neighborhood_mark = 1;
+  }
+  
+  std::vector<int> found;
+  found.push_back(cell_id);
+  m_neighborhood_marks[cell_id] = m_neighborhood_mark;
+  
+  size_t frontier_start = 0;
+  for (int hop = 0; hop < depth && frontier_start < found.size(); hop++) {
+    const size_t frontier_end = found.size();
+    for (size_t i = frontier_start; i < frontier_end; i++) {
+      tConstListIterator<cPopulationCell> conn_it(cell_array[found[i]].ConnectionList());
+      while (!conn_it.AtEnd()) {
+        const int conn_id = conn_it.Next()->GetID();
+        if (m_neighborhood_marks[conn_id] != m_neighborhood_mark) {
+          m_neighborhood_marks[conn_id] = m_neighborhood_mark;
+          found.push_back(conn_id);
+        }
+      }
+    }
+    frontier_start = frontier_end;
+  }
+  
+  // Leave out the cell itself
+  std::sort(found.begin() + 1, found.end());
+  Apto::Array<int, Apto::Smart> neighbors(static_cast<int>(found.size()) - 1);
+  for (int i = 0; i < neighbors.GetSize(); i++) neighbors[i] = found[i + 1];
+  
+  return m_cell_neighborhoods.Set(cell_id, depth, neighbors);
+}
+
+
+// All demes share a geometry, so the table is indexed by deme relative cell ID
+cNeighborhoodTable::Span cPopulation::GetDemeNeighborhood(int cell_id, int range)
+{
+  cDeme& deme = deme_array[cell_array[cell_id].GetDemeID()];
+  const int rel_id = deme.GetRelativeCellID(cell_id);
+  if (m_deme_neighborhoods.Has(rel_id, range)) return m_deme_neighborhoods.Get(rel_id, range);
+  
+  const pair<int, int> pos = deme.GetCellPosition(cell_id);
+  Apto::Array<int, Apto::Smart> neighbors;
+  for (int i = 0; i < deme.GetSize(); i++) {
+    if (i == rel_id) continue;
+    const pair<int, int> other_pos = deme.GetCellPosition(deme.GetCellID(i));
+    const int distance = max(abs(pos.first - other_pos.first), abs(pos.second - other_pos.second));
+    if (distance <= range) neighbors.Push(i);
+  }
+  
+  return m_deme_neighborhoods.Set(rel_id, range, neighbors);
+}
+
+// Averages a phenotype value over the occupied cells of a range of demes.  Each job only reads phenotypes and
+// writes the entries of its own demes, so the results do not depend on how the jobs are scheduled.
+class cDemeAverageJob
+{
+public:
+  enum eValue { FITNESS, DIV_RATE, LIFE_FITNESS };
+
+private:
+  cPopulation* m_pop;
+  eValue m_value;
+  int m_begin;
+  int m_end;
+  Apto::Array<double>& m_averages;
+
+public:
+  cDemeAverageJob(cPopulation* pop, eValue value, int begin, int end, Apto::Array<double>& averages)
+    : m_pop(pop), m_value(value), m_begin(begin), m_end(end), m_averages(averages) { ; }
+
+  void Run(cAvidaContext&)
+  {
+    for (int deme_id = m_begin; deme_id < m_end; deme_id++) {
+      cDoubleSum deme_sum;
+      const cDeme& cur_deme = m_pop->GetDeme(deme_id);
+      for (int i = 0; i < cur_deme.GetSize(); i++) {
+        cPopulationCell& cell = m_pop->GetCell(cur_deme.GetCellID(i));
+        if (cell.IsOccupied() == false) continue;
+        const cPhenotype& phenotype = cell.GetOrganism()->GetPhenotype();
+        switch (m_value) {
+          case FITNESS: deme_sum.Add(phenotype.GetFitness()); break;
+          case DIV_RATE:
+            assert(phenotype.GetDivType() > 0);
+            deme_sum.Add(1 / phenotype.GetDivType());
+            break;
+          case LIFE_FITNESS: deme_sum.Add(phenotype.GetLifeFitness()); break;
+        }
+      }
+      m_averages[deme_id] = deme_sum.Ave();
+    }
+  }
+};
+
+static const int DEME_AVERAGE_JOB_SIZE = 64;
+
+static void averageDemePhenotypes(cWorld* world, cPopulation* pop, cDemeAverageJob::eValue value,
+                                  Apto::Array<double>& averages)
+{
+  const int num_demes = averages.GetSize();
+  Apto::Array<cDemeAverageJob*> jobs;
+  for (int begin = 0; begin < num_demes; begin += DEME_AVERAGE_JOB_SIZE) {
+    const int end = (begin + DEME_AVERAGE_JOB_SIZE < num_demes) ? begin + DEME_AVERAGE_JOB_SIZE : num_demes;
+    jobs.Push(new cDemeAverageJob(pop, value, begin, end, averages));
+  }
+
+  tAnalyzeJobBatch<cDemeAverageJob> jobbatch(world->GetJobQueue());
+  for (int i = 0; i < jobs.GetSize(); i++) jobbatch.AddJob(jobs[i], &cDemeAverageJob::Run);
+  jobbatch.RunBatch();
+
+  for (int i = 0; i < jobs.GetSize(); i++) delete jobs[i];
+}
+
+// Converts deme values into 2^(-rank), where rank is one more than the number of demes with a strictly higher value.
+// A NaN value compares false against everything, so it is never higher than another deme and ranks first itself.
+// NaNs are left out of the sorted values, which keeps the ordering valid for sort and the searches.
+static void rankDemeFitness(Apto::Array<double>& deme_fitness)
+{
+  const int num_demes = deme_fitness.GetSize();
+  std::vector<double> sorted;
+  sorted.reserve(num_demes);
+  for (int i = 0; i < num_demes; i++) if (deme_fitness[i] == deme_fitness[i]) sorted.push_back(deme_fitness[i]);
+  std::sort(sorted.begin(), sorted.end());
+
+  for (int deme_id = 0; deme_id < num_demes; deme_id++) {
+    int num_higher = 0;
+    if (deme_fitness[deme_id] == deme_fitness[deme_id]) {
+      num_higher = sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), deme_fitness[deme_id]);
+    }
+    deme_fitness[deme_id] = std::ldexp(1.0, -(num_higher + 1));
+  }
+}
+
+// Running totals of the given weights, summed in the same order as a linear roulette scan.  Returns false if the
+// totals are not ordered (negative or NaN weights), in which case they can only be searched linearly.
+static bool cumulativeWeights(const double* weights, int num_weights, Apto::Array<double>& cumulative)
+{
+  cumulative.Resize(num_weights);
+  bool ordered = true;
+  double running_sum = 0.0;
+  for (int i = 0; i < num_weights; i++) {
+    running_sum += weights[i];
+    cumulative[i] = running_sum;
+    if (!(running_sum >= ((i > 0) ? cumulative[i - 1] : 0.0))) ordered = false;
+  }
+  return ordered;
+}
+
+// Returns the first index whose running total exceeds choice (or reaches it, if inclusive), -1 if there is none
+static int findCumulativeWeight(const Apto::Array<double>& cumulative, bool ordered, double choice, bool inclusive)
+{
+  const int size = cumulative.GetSize();
+  if (!ordered) {
+    for (int i = 0; i < size; i++) {
+      if (cumulative[i] > choice || (inclusive && cumulative[i] == choice)) return i;
+    }
+    return -1;
+  }
+
+  int lo = 0;
+  int hi = size;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (cumulative[mid] > choice || (inclusive && cumulative[mid] == choice)) hi = mid;
+    else lo = mid + 1;
+  }
+  return (lo < size) ? lo : -1;
+}
+
+
 // CompeteDemes  probabilistically copies demes into the next generation
 // based on their fitness. How deme fitness is estimated is specified by
 // competition_type input argument as:
@@ -2087,132 +2289,37 @@ void cPopulation::CompeteDemes(cAvidaContext& ctx, int competition_type)
       }
       break;
     case 2:    // deme fitness = average organism fitness at the current update
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        cDoubleSum single_deme_fitness;
-        const cDeme & cur_deme = deme_array[deme_id];
-        for (int i = 0; i < cur_deme.GetSize(); i++) {
-          int cur_cell = cur_deme.GetCellID(i);
-          if (cell_array[cur_cell].IsOccupied() == false) continue;
-          cPhenotype & phenotype =
-          GetCell(cur_cell).GetOrganism()->GetPhenotype();
-          single_deme_fitness.Add(phenotype.GetFitness());
-        }
-        deme_fitness[deme_id] = single_deme_fitness.Ave();
-        total_fitness += deme_fitness[deme_id];
-      }
+      averageDemePhenotypes(m_world, this, cDemeAverageJob::FITNESS, deme_fitness);
+      for (int deme_id = 0; deme_id < num_demes; deme_id++) total_fitness += deme_fitness[deme_id];
       break;
     case 3: 	// deme fitness = average mutation rate at the current update
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        cDoubleSum single_deme_div_type;
-        const cDeme & cur_deme = deme_array[deme_id];
-        for (int i = 0; i < cur_deme.GetSize(); i++) {
-          int cur_cell = cur_deme.GetCellID(i);
-          if (cell_array[cur_cell].IsOccupied() == false) continue;
-          cPhenotype & phenotype =
-          GetCell(cur_cell).GetOrganism()->GetPhenotype();
-          assert(phenotype.GetDivType()>0);
-          single_deme_div_type.Add(1/phenotype.GetDivType());
-        }
-        deme_fitness[deme_id] = single_deme_div_type.Ave();
-        total_fitness += deme_fitness[deme_id];
-      }
+      averageDemePhenotypes(m_world, this, cDemeAverageJob::DIV_RATE, deme_fitness);
+      for (int deme_id = 0; deme_id < num_demes; deme_id++) total_fitness += deme_fitness[deme_id];
       break;
     case 4: 	// deme fitness = 2^(-deme fitness rank)
-      // first find all the deme fitness values ...
-    {
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        cDoubleSum single_deme_fitness;
-        const cDeme & cur_deme = deme_array[deme_id];
-        for (int i = 0; i < cur_deme.GetSize(); i++) {
-          int cur_cell = cur_deme.GetCellID(i);
-          if (cell_array[cur_cell].IsOccupied() == false) continue;
-          cPhenotype & phenotype = GetCell(cur_cell).GetOrganism()->GetPhenotype();
-          single_deme_fitness.Add(phenotype.GetFitness());
-        }
-        deme_fitness[deme_id] = single_deme_fitness.Ave();
-      }
-      // ... then determine the rank of each deme based on its fitness
-      Apto::Array<double> deme_rank(num_demes);
-      deme_rank.SetAll(1);
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        for (int test_deme = 0; test_deme < num_demes; test_deme++) {
-          if (deme_fitness[deme_id] < deme_fitness[test_deme]) {
-            deme_rank[deme_id]++;
-          }
-        }
-      }
-      // ... finally, make deme fitness 2^(-deme rank)
-      deme_fitness.SetAll(1);
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        for (int i = 0; i < deme_rank[deme_id]; i++) {
-          deme_fitness[deme_id] = deme_fitness[deme_id]/2;
-        }
-        total_fitness += deme_fitness[deme_id];
-      }
-    }
+      averageDemePhenotypes(m_world, this, cDemeAverageJob::FITNESS, deme_fitness);
+      rankDemeFitness(deme_fitness);
+      for (int deme_id = 0; deme_id < num_demes; deme_id++) total_fitness += deme_fitness[deme_id];
       break;
     case 5:    // deme fitness = average organism life fitness at the current update
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        cDoubleSum single_deme_life_fitness;
-        const cDeme & cur_deme = deme_array[deme_id];
-        for (int i = 0; i < cur_deme.GetSize(); i++) {
-          int cur_cell = cur_deme.GetCellID(i);
-          if (cell_array[cur_cell].IsOccupied() == false) continue;
-          cPhenotype & phenotype = GetCell(cur_cell).GetOrganism()->GetPhenotype();
-          single_deme_life_fitness.Add(phenotype.GetLifeFitness());
-        }
-        deme_fitness[deme_id] = single_deme_life_fitness.Ave();
-        total_fitness += deme_fitness[deme_id];
-      }
+      averageDemePhenotypes(m_world, this, cDemeAverageJob::LIFE_FITNESS, deme_fitness);
+      for (int deme_id = 0; deme_id < num_demes; deme_id++) total_fitness += deme_fitness[deme_id];
       break;
     case 6:     // deme fitness = 2^(-deme life fitness rank) (same as 4, but with life fitness)
-      // first find all the deme fitness values ...
-    {
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        cDoubleSum single_deme_life_fitness;
-        const cDeme & cur_deme = deme_array[deme_id];
-        for (int i = 0; i < cur_deme.GetSize(); i++) {
-          int cur_cell = cur_deme.GetCellID(i);
-          if (cell_array[cur_cell].IsOccupied() == false) continue;
-          cPhenotype & phenotype = GetCell(cur_cell).GetOrganism()->GetPhenotype();
-          single_deme_life_fitness.Add(phenotype.GetLifeFitness());
-        }
-        deme_fitness[deme_id] = single_deme_life_fitness.Ave();
-      }
-      // ... then determine the rank of each deme based on its fitness
-      Apto::Array<double> deme_rank(num_demes);
-      deme_rank.SetAll(1);
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        for (int test_deme = 0; test_deme < num_demes; test_deme++) {
-          if (deme_fitness[deme_id] < deme_fitness[test_deme]) {
-            deme_rank[deme_id]++;
-          }
-        }
-      }
-      // ... finally, make deme fitness 2^(-deme rank)
-      deme_fitness.SetAll(1);
-      for (int deme_id = 0; deme_id < num_demes; deme_id++) {
-        for (int i = 0; i < deme_rank[deme_id]; i++) {
-          deme_fitness[deme_id] = deme_fitness[deme_id]/2;
-        }
-        total_fitness += deme_fitness[deme_id];
-      }
-    }
+      averageDemePhenotypes(m_world, this, cDemeAverageJob::LIFE_FITNESS, deme_fitness);
+      rankDemeFitness(deme_fitness);
+      for (int deme_id = 0; deme_id < num_demes; deme_id++) total_fitness += deme_fitness[deme_id];
       break;
   }
   
   // Pick which demes should be in the next generation.
+  Apto::Array<double> cumulative_fitness;
+  const bool ordered = cumulativeWeights(num_demes ? &deme_fitness[0] : NULL, num_demes, cumulative_fitness);
   Apto::Array<int> new_demes(num_demes);
   for (int i = 0; i < num_demes; i++) {
     double birth_choice = (double) m_world->GetRandom().GetDouble(total_fitness);
-    double test_total = 0;
-    for (int test_deme = 0; test_deme < num_demes; test_deme++) {
-      test_total += deme_fitness[test_deme];
-      if (birth_choice < test_total) {
-        new_demes[i] = test_deme;
-        break;
-      }
-    }
+    const int test_deme = findCumulativeWeight(cumulative_fitness, ordered, birth_choice, false);
+    if (test_deme >= 0) new_demes[i] = test_deme;
   }
   
   // Track how many of each deme we should have.
@@ -2254,26 +2361,14 @@ void cPopulation::CompeteDemes(cAvidaContext& ctx, int competition_type)
     // time that someone comes in here looking to refactor, consider fixing this.
     
     // Do the actual copy!
-    for (int i = 0; i < from_deme.GetSize(); i++) {
-      int from_cell_id = from_deme.GetCellID(i);
-      int to_cell_id = to_deme.GetCellID(i);
-      if (cell_array[from_cell_id].IsOccupied() == true) {
-        InjectClone(to_cell_id, *(cell_array[from_cell_id].GetOrganism()), Systematics::Source(Systematics::DUPLICATION, ""));
-      }
-    }
+    CloneDemeCells(from_deme, to_deme, false, ctx);
     is_init[to_deme_id] = true;
   }
   
   // Now re-inject all remaining demes into themselves to reset them.
   for (int deme_id = 0; deme_id < num_demes; deme_id++) {
     if (is_init[deme_id] == true) continue;
-    cDeme & cur_deme = deme_array[deme_id];
-    
-    for (int i = 0; i < cur_deme.GetSize(); i++) {
-      int cur_cell_id = cur_deme.GetCellID(i);
-      if (cell_array[cur_cell_id].IsOccupied() == false) continue;
-      InjectClone(cur_cell_id, *(cell_array[cur_cell_id].GetOrganism()), cell_array[cur_cell_id].GetOrganism()->UnitSource());
-    }
+    CloneDemeCells(deme_array[deme_id], deme_array[deme_id], false, ctx);
   }
   
   // Reset all deme stats to zero.
@@ -2387,19 +2482,14 @@ void cPopulation::CompeteDemes(const std::vector<double>& calculated_fitness, cA
       const double total_fitness = std::accumulate(fitness.begin(), fitness.end(), 0.0);
       assert(total_fitness > 0.0); // Must have *some* positive fitnesses...
       
-      // Sum up the fitnesses until we reach or exceed the target fitness.
+      // Find the first deme whose running fitness total reaches the target fitness.
       // Then we're marking that deme as being part of the next generation.
+      Apto::Array<double> cumulative_fitness;
+      const bool ordered = cumulativeWeights(&fitness[0], (int)fitness.size(), cumulative_fitness);
       for (int i=0; i<deme_array.GetSize(); ++i) {
-        double running_sum = 0.0;
         double target_sum = m_world->GetRandom().GetDouble(total_fitness);
-        for (int j=0; j<deme_array.GetSize(); ++j) {
-          running_sum += fitness[j];
-          if (running_sum >= target_sum) {
-            // j'th deme will be replicated.
-            ++deme_counts[j];
-            break;
-          }
-        }
+        const int j = findCumulativeWeight(cumulative_fitness, ordered, target_sum, true);
+        if (j >= 0) ++deme_counts[j]; // j'th deme will be replicated.
       }
       break;
     }
@@ -3867,11 +3957,7 @@ void cPopulation::ResetDemes()
 {
   // re-inject all demes into themselves to reset them.
   for (int deme_id = 0; deme_id < deme_array.GetSize(); deme_id++) {
-    for (int i = 0; i < deme_array[deme_id].GetSize(); i++) {
-      int cur_cell_id = deme_array[deme_id].GetCellID(i);
-      if (cell_array[cur_cell_id].IsOccupied() == false) continue;
-      InjectClone(cur_cell_id, *(cell_array[cur_cell_id].GetOrganism()), cell_array[cur_cell_id].GetOrganism()->UnitSource());
-    }
+    CloneDemeCells(deme_array[deme_id], deme_array[deme_id], false, m_world->GetDefaultContext());
   }
 }
 
@@ -3880,17 +3966,36 @@ void cPopulation::ResetDemes()
 
 void cPopulation::CopyDeme(int deme1_id, int deme2_id, cAvidaContext& ctx) 
 {
-  cDeme & deme1 = deme_array[deme1_id];
-  cDeme & deme2 = deme_array[deme2_id];
+  CloneDemeCells(deme_array[deme1_id], deme_array[deme2_id], true, ctx);
+}
+
+
+// Clone every occupied cell of from_deme into the same position of to_deme in one pass, optionally clearing the
+// positions that are empty in from_deme.  Each clone is classified directly into the genotype of its source, which
+// is still active while the source is alive, rather than by searching for its genome.  A deme cloned into itself is
+// reset, and its organisms keep their original sources.
+
+void cPopulation::CloneDemeCells(cDeme& from_deme, cDeme& to_deme, bool clear_empty, cAvidaContext& ctx)
+{
+  const bool reset = (from_deme.GetDemeID() == to_deme.GetDemeID());
+  Systematics::RoleClassificationHints hints;
   
-  for (int i = 0; i < deme1.GetSize(); i++) {
-    int from_cell = deme1.GetCellID(i);
-    int to_cell = deme2.GetCellID(i);
+  for (int i = 0; i < from_deme.GetSize(); i++) {
+    const int from_cell = from_deme.GetCellID(i);
+    const int to_cell = to_deme.GetCellID(i);
     if (cell_array[from_cell].IsOccupied() == false) {
-      KillOrganism(cell_array[to_cell], ctx); 
+      if (clear_empty) KillOrganism(cell_array[to_cell], ctx);
       continue;
     }
-    InjectClone(to_cell, *(cell_array[from_cell].GetOrganism()), Systematics::Source(Systematics::DUPLICATION, ""));
+    
+    cOrganism* org = cell_array[from_cell].GetOrganism();
+    Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
+    Systematics::RoleClassificationHints* clone_hints = NULL;
+    if (genotype) {
+      hints["genotype"]["id"] = Apto::FormatStr("%d", genotype->ID());
+      clone_hints = &hints;
+    }
+    InjectClone(to_cell, *org, (reset) ? org->UnitSource() : Systematics::Source(Systematics::DUPLICATION, ""), clone_hints);
   }
 }
 
@@ -4789,26 +4894,10 @@ cPopulationCell& cPopulation::PositionOffspring(cPopulationCell& parent_cell, cA
 //    if (pop_enforce > 1 && num_organisms != pop_cap) num_kills += min(num_organisms - pop_cap, pop_enforce);
     
     while (num_kills > 0) {
-      double max_age = 0.0;
-      double max_msr = 0.0;
-      int cell_id = 0;
-      for (int i = 0; i < live_org_list.GetSize(); i++) {
-        if (GetCell(live_org_list[i]->GetCellID()).IsOccupied() && live_org_list[i]->GetCellID() != parent_cell.GetID()) {       
-          double age = live_org_list[i]->GetPhenotype().GetAge();
-          if (age > max_age) {
-            max_age = age;
-            cell_id = live_org_list[i]->GetCellID();
-          }
-          else if (age == max_age) {
-            double msr = m_world->GetRandom().GetDouble();
-            if (msr > max_msr) {
-              max_msr = msr;
-              cell_id = live_org_list[i]->GetCellID();
-            }
-          }
-        }
-      }
-      KillOrganism(cell_array[cell_id], ctx);
+      // Ties for the oldest are broken uniformly at random
+      cOrganism* eldest = m_age_index.FindEldest(m_world->GetRandom(), parent_cell.GetOrganism());
+      if (eldest == NULL) break;
+      KillOrganism(cell_array[eldest->GetCellID()], ctx);
       num_kills--;
     }
   }
@@ -5285,11 +5374,13 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
   // If cell_id is negative, no cell could be found -- stop here.
   if (cell_id < 0) return;
   
-  cPopulationCell& cell = GetCell(cell_id);
-  assert(cell.IsOccupied()); // Unoccupied cell getting processor time!
-  cOrganism* cur_org = cell.GetOrganism();
+  assert(m_step_state.IsOccupied(cell_id)); // Unoccupied cell getting processor time!
+  cOrganism* cur_org = m_step_state.GetOrganism(cell_id);
+  
+  cInstProfile::Cycles phase_start = (m_profiler) ? cInstProfile::ReadCycles() : 0;
   
-  cell.GetHardware()->SingleProcess(ctx);
+  // Organisms holding a deferred divide do not execute until it has been completed in ProcessPostUpdate
+  if (!cur_org->IsDivideTestPending()) m_step_state.GetHardware(cell_id)->SingleProcess(ctx);
   
   double merit = cur_org->GetPhenotype().GetMerit().GetDouble();
   if (cur_org->GetPhenotype().GetToDelete() == true) {
@@ -5297,6 +5388,12 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
     delete cur_org;
   }
   
+  if (m_profiler) {
+    const cInstProfile::Cycles phase_end = cInstProfile::ReadCycles();
+    m_profiler->AddPhaseCycles(cProfiler::PHASE_EXECUTE, phase_end - phase_start);
+    phase_start = phase_end;
+  }
+  
   m_world->GetStats().IncExecuted();
   resource_count.Update(step_size);
   
@@ -5305,7 +5402,9 @@ void cPopulation::ProcessStep(cAvidaContext& ctx, double step_size, int cell_id)
     GetDeme(i).Update(step_size);
   }
   
-  cDeme & deme = GetDeme(GetCell(cell_id).GetDemeID());
+  if (m_profiler) m_profiler->AddPhaseCycles(cProfiler::PHASE_RESOURCES, cInstProfile::ReadCycles() - phase_start);
+  
+  cDeme & deme = GetDeme(m_step_state.GetDemeID(cell_id));
   deme.IncTimeUsed(merit);
   
   if (GetNumDemes() >= 1) {
@@ -5322,34 +5421,43 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   // If cell_id is negative, no cell could be found -- stop here.
   if (cell_id < 0) return;
   
-  cPopulationCell& cell = GetCell(cell_id);
-  assert(cell.IsOccupied()); // Unoccupied cell getting processor time!
+  assert(m_step_state.IsOccupied(cell_id)); // Unoccupied cell getting processor time!
   
-  cOrganism* cur_org = cell.GetOrganism();
-  cHardwareBase* hw = cell.GetHardware();
+  cOrganism* cur_org = m_step_state.GetOrganism(cell_id);
+  cHardwareBase* hw = m_step_state.GetHardware(cell_id);
   
-  if (cell.GetSpeculativeState()) {
+  cInstProfile::Cycles phase_start = (m_profiler) ? cInstProfile::ReadCycles() : 0;
+  
+  if (m_step_state.GetSpeculativeState(cell_id)) {
     // We have already executed this instruction, just decrement the counter
-    cell.DecSpeculative();
-  } else {
+    m_step_state.DecSpeculative(cell_id);
+  } else if (!cur_org->IsDivideTestPending()) {
     // Execute the actual instruction
-    if (hw->SingleProcess(ctx)) {
+    if (hw->SingleProcess(ctx) && !cur_org->IsDivideTestPending()) {
       // Speculatively execute additional instructions
       int spec_count = 0;
+      bool rollback = false;
       while (spec_count < 32) {
         if (hw->SingleProcess(ctx, true)) spec_count++;
-        else break;
+        else { rollback = true; break; }
       }
-      cell.SetSpeculativeState(spec_count);
+      m_step_state.SetSpeculativeState(cell_id, spec_count);
       m_world->GetStats().AddSpeculative(spec_count);
+      if (m_profiler) m_profiler->AddSpeculative(spec_count, rollback);
     }
   }
   
+  if (m_profiler) {
+    const cInstProfile::Cycles phase_end = cInstProfile::ReadCycles();
+    m_profiler->AddPhaseCycles(cProfiler::PHASE_EXECUTE, phase_end - phase_start);
+    phase_start = phase_end;
+  }
+  
   // Deme specific
   if (GetNumDemes() > 1) {
     for(int i = 0; i < GetNumDemes(); i++) GetDeme(i).Update(step_size);
     
-    cDeme& deme = GetDeme(GetCell(cell_id).GetDemeID());
+    cDeme& deme = GetDeme(m_step_state.GetDemeID(cell_id));
     deme.IncTimeUsed(cur_org->GetPhenotype().GetMerit().GetDouble());
     CheckImplicitDemeRepro(deme, ctx); 
   }
@@ -5362,6 +5470,8 @@ void cPopulation::ProcessStepSpeculative(cAvidaContext& ctx, double step_size, i
   
   m_world->GetStats().IncExecuted();
   resource_count.Update(step_size);
+  
+  if (m_profiler) m_profiler->AddPhaseCycles(cProfiler::PHASE_RESOURCES, cInstProfile::ReadCycles() - phase_start);
 }
 
 // Loop through all the demes getting stats and doing calculations
@@ -5592,6 +5702,7 @@ void cPopulation::UpdateOrganismStats(cAvidaContext& ctx)
     // Increment the age of this organism.
     organism->GetPhenotype().IncAge();
   }
+  m_age_index.AdvancePass();
   
   stats.SetBreedTrueCreatures(num_breed_true);
   stats.SetNumNoBirthCreatures(num_no_birth);
@@ -5800,6 +5911,12 @@ void cPopulation::ProcessPreUpdate()
 
 void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
 {
+  // Commit any divides that were held for offspring testing during this update, before any post-update stats or
+  // cell actions look at the population
+  m_divide_tests.ProcessDeferred(ctx);
+  
+  const cInstProfile::Cycles stats_start = (m_profiler) ? cInstProfile::ReadCycles() : 0;
+  
   ProcessUpdateCellActions(ctx);
   
   cStats& stats = m_world->GetStats();
@@ -5816,6 +5933,11 @@ void cPopulation::ProcessPostUpdate(cAvidaContext& ctx)
   }
   
   for (int i = 0; i < deme_array.GetSize(); i++) deme_array[i].ProcessUpdate(ctx);   
+  
+  if (m_profiler) {
+    m_profiler->AddPhaseCycles(cProfiler::PHASE_STATS, cInstProfile::ReadCycles() - stats_start);
+    m_profiler->UpdateComplete();
+  }
 }
 
 void cPopulation::ProcessUpdateCellActions(cAvidaContext& ctx)
@@ -6864,7 +6986,7 @@ void cPopulation::FindEmptyCell(tList<cPopulationCell> & cell_list,
 // This function injects a new organism into the population at cell_id that
 // is an exact clone of the organism passed in.
 
-void cPopulation::InjectClone(int cell_id, cOrganism& orig_org, Systematics::Source src)
+void cPopulation::InjectClone(int cell_id, cOrganism& orig_org, Systematics::Source src, Systematics::RoleClassificationHints* hints)
 {
   assert(cell_id >= 0 && cell_id < cell_array.GetSize());
   
@@ -6875,7 +6997,7 @@ void cPopulation::InjectClone(int cell_id, cOrganism& orig_org, Systematics::Sou
   new_organism->AddReference(); // creating new smart pointer to new_organism, explicitly add reference
   
   // Classify the new organism
-  Systematics::Manager::Of(m_world->GetNewWorld())->ClassifyNewUnit(unit);
+  Systematics::Manager::Of(m_world->GetNewWorld())->ClassifyNewUnit(unit, hints);
   
   // Setup the phenotype...
   new_organism->GetPhenotype().SetupClone(orig_org.GetPhenotype());
@@ -7405,13 +7527,13 @@ void cPopulation::NewTrial(cAvidaContext& ctx)
       // Don't continue if the time used was zero
       if (p.GetTrialTimeUsed() != 0) {
         // Correct gestation time for speculative execution
-        p.SetTrialTimeUsed(p.GetTrialTimeUsed() - cell.GetSpeculativeState());
-        p.SetTimeUsed(p.GetTimeUsed() - cell.GetSpeculativeState());
+        p.SetTrialTimeUsed(p.GetTrialTimeUsed() - m_step_state.GetSpeculativeState(i));
+        p.SetTimeUsed(p.GetTimeUsed() - m_step_state.GetSpeculativeState(i));
         
         cell.GetOrganism()->NewTrial();
         cell.GetOrganism()->GetHardware().Reset(ctx);
         
-        cell.SetSpeculativeState(0);
+        m_step_state.SetSpeculativeState(i, 0);
       }
     }
   }
@@ -8039,6 +8161,15 @@ void  cPopulation::AddLiveOrg(cOrganism* org)
 {
   live_org_list.Push(org);
   org->SetOrgIndex(live_org_list.GetSize()-1);
+  m_age_index.Insert(org);
+  
+  // Organisms created within the same birth event can share an ID, the first one in keeps the index entry
+  const int org_id = org->GetID();
+  if (m_live_org_ids.Has(org_id)) {
+    m_live_org_id_collisions.Set(org_id, m_live_org_id_collisions.GetWithDefault(org_id, 0) + 1);
+  } else {
+    m_live_org_ids.Set(org_id, org);
+  }
 }
 
 // Remove an organism from live org list  
@@ -8049,6 +8180,28 @@ void  cPopulation::RemoveLiveOrg(cOrganism* org)
   exist_org->SetOrgIndex(org->GetOrgIndex());
   live_org_list.Swap(org->GetOrgIndex(), last);
   live_org_list.Pop();
+  m_age_index.Remove(org);
+  
+  // Only removals of an ID that is shared with another live organism need to adjust the collision count, or search
+  // for the organism to hand the index entry to
+  const int org_id = org->GetID();
+  const int collisions = m_live_org_id_collisions.GetWithDefault(org_id, 0);
+  if (collisions == 0) {
+    m_live_org_ids.Remove(org_id);
+    return;
+  }
+  
+  if (collisions == 1) m_live_org_id_collisions.Remove(org_id);
+  else m_live_org_id_collisions.Set(org_id, collisions - 1);
+  if (m_live_org_ids.GetWithDefault(org_id, NULL) != org) return;
+  
+  // Hand the index entry to another live organism with the same ID
+  for (int i = 0; i < live_org_list.GetSize(); i++) {
+    if (live_org_list[i]->GetID() == org_id) {
+      m_live_org_ids.Set(org_id, live_org_list[i]);
+      break;
+    }
+  }
 }
 
 
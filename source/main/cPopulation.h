@@ -25,8 +25,13 @@
 
 #include "avida/data/Provider.h"
 
+#include "cAgeIndex.h"
 #include "cBirthChamber.h"
+#include "cCellStepState.h"
 #include "cDeme.h"
+#include "cDivideTestQueue.h"
+#include "cNeighborhoodTable.h"
+#include "cOccupancyIndex.h"
 #include "cOrgInterface.h"
 #include "cPopulationInterface.h"
 #include "cResourceCount.h"
@@ -44,6 +49,7 @@ class cEnvironment;
 class cLineage;
 class cOrganism;
 class cPopulationCell;
+class cProfiler;
 
 using namespace Avida;
 
@@ -70,6 +76,8 @@ private:
   Apto::Array<int> empty_cell_id_array;     // Used for PREFER_EMPTY birth methods
   cResourceCount resource_count;       // Global resources available
   cBirthChamber birth_chamber;         // Global birth chamber.
+  cDivideTestQueue m_divide_tests;     // Offspring tests for divides that revert or sterilize mutants
+  cProfiler* m_profiler;               // Execution profile, NULL unless PROFILE_EXECUTION is set
   //Keeps track of which organisms are in which group.
   Apto::Map<int, Apto::Array<cOrganism*, Apto::Smart> > m_group_list;
   Apto::Map<int, Apto::Array<pair<int,int> > > m_group_intolerances;
@@ -79,6 +87,9 @@ private:
   
   // Keep list of live organisms
   Apto::Array<cOrganism*, Apto::Smart> live_org_list;
+  Apto::Map<int, cOrganism*> m_live_org_ids;    // organism ID -> live organism
+  Apto::Map<int, int> m_live_org_id_collisions; // organism ID -> other live organisms sharing it, if any
+  cAgeIndex m_age_index;                        // live organisms by age, for POP_CAP_ELDEST
   
   Apto::Array<cPopulationOrgStatProviderPtr> m_org_stat_providers;
   
@@ -111,6 +122,15 @@ private:
   bool m_has_predatory_res;
   
   Apto::Array<cDeme> deme_array;            // Deme structure of the population.
+  
+  // Cached neighborhoods, for broadcasts
+  cNeighborhoodTable m_cell_neighborhoods;  // cells within N connection hops, by cell ID
+  cNeighborhoodTable m_deme_neighborhoods;  // cells within N grid steps in a deme, by deme relative cell ID
+  Apto::Array<int> m_neighborhood_marks;
+  int m_neighborhood_mark;
+  
+  cOccupancyIndex m_occupancy;              // organism and avatar counts by cell, maintained by cPopulationCell
+  cCellStepState m_step_state;              // per cell fields read by each scheduler step
  
   // Outside interactions...
   bool sync_events;   // Do we need to sync up the event list with population?
@@ -285,6 +305,7 @@ public:
   void SetNextPredQ(int num_pred, bool print_genomes, bool print_reacs, bool use_micro);
   Apto::Array<int, Apto::Smart> SetTraceQ(int save_dominants, int save_groups, int save_foragers, int orgs_per, int max_samples);
   const Apto::Array<int, Apto::Smart>& GetMiniTraceQueue() const { return minitrace_queue; }
+  bool GetMiniTracePrintReactions() const { return print_mini_trace_reacs; }
   void AppendRecordReproQ(cOrganism* new_org);
   void SetTopNavQ();
   Apto::Array<cOrganism*, Apto::Smart> GetTopNavQ() { return topnav_q; }
@@ -296,6 +317,18 @@ public:
   cDeme& GetDeme(int i) { return deme_array[i]; }
 
   cPopulationCell& GetCell(int in_num) { return cell_array[in_num]; }
+  
+  // Cells (other than cell_id) that are reachable in at most depth connection hops, in cell ID order
+  cNeighborhoodTable::Span GetCellNeighborhood(int cell_id, int depth);
+  // Deme relative IDs of the cells (other than cell_id) in the same deme within range grid steps, in deme order
+  cNeighborhoodTable::Span GetDemeNeighborhood(int cell_id, int range);
+  // Must be called whenever cell connection lists are modified
+  void CellConnectionsChanged() { m_cell_neighborhoods.Reset(cell_array.GetSize()); }
+  
+  cOccupancyIndex& GetOccupancyIndex() { return m_occupancy; }
+  const cOccupancyIndex& GetOccupancyIndex() const { return m_occupancy; }
+  cCellStepState& GetStepState() { return m_step_state; }
+  const cCellStepState& GetStepState() const { return m_step_state; }
   const Apto::Array<double>& GetResources(cAvidaContext& ctx) const { return resource_count.GetResources(ctx); }
   const Apto::Array<double>& GetCellResources(int cell_id, cAvidaContext& ctx) const { return resource_count.GetCellResources(cell_id, ctx); } 
   const Apto::Array<double>& GetFrozenResources(cAvidaContext& ctx, int cell_id) const { return resource_count.GetFrozenResources(ctx, cell_id); }
@@ -313,6 +346,7 @@ public:
   Apto::Array<int>* GetWallCells(int res_id) { return resource_count.GetWallCells(res_id); }
 
   cBirthChamber& GetBirthChamber(int id) { (void) id; return birth_chamber; }
+  cDivideTestQueue& GetDivideTestQueue() { return m_divide_tests; }
 
   void UpdateResources(cAvidaContext& ctx, const Apto::Array<double>& res_change);
   void UpdateResource(cAvidaContext& ctx, int id, double change);
@@ -391,6 +425,8 @@ public:
   // Remove an org from live org list
   void RemoveLiveOrg(cOrganism* org); 
   const Apto::Array<cOrganism*, Apto::Smart>& GetLiveOrgList() const { return live_org_list; }
+  // Find a live org by ID, NULL if no living organism has the ID
+  cOrganism* GetLiveOrgByID(int org_id) const { return m_live_org_ids.GetWithDefault(org_id, NULL); }
 	
   // Adds an organism to a group  
   void JoinGroup(cOrganism* org, int group_id);
@@ -459,7 +495,8 @@ private:
   void UpdateFTOrgStats(cAvidaContext& ctx); 
   void UpdateMaleFemaleOrgStats(cAvidaContext& ctx);
   
-  void InjectClone(int cell_id, cOrganism& orig_org, Systematics::Source src);
+  void InjectClone(int cell_id, cOrganism& orig_org, Systematics::Source src, Systematics::RoleClassificationHints* hints = NULL);
+  void CloneDemeCells(cDeme& from_deme, cDeme& to_deme, bool clear_empty, cAvidaContext& ctx);
   void CompeteOrganisms_ConstructOffspring(int cell_id, cOrganism& parent);
   
   //! Helper method that adds a founder organism to a deme, and sets up its phenotype
@@ -29,6 +29,7 @@
 #include "cWorld.h"
 #include "cEnvironment.h"
 #include "cPopulation.h"
+#include "cProfiler.h"
 #include "cDeme.h"
 
 #include <cmath>
@@ -45,7 +46,6 @@ cPopulationCell::cPopulationCell(const cPopulationCell& in_cell)
 , m_cell_id(in_cell.m_cell_id)
 , m_deme_id(in_cell.m_deme_id)
 , m_cell_data(in_cell.m_cell_data)
-, m_spec_state(in_cell.m_spec_state)
 , m_can_input(false)
 , m_can_output(false)
 , m_hgt(0)
@@ -75,7 +75,6 @@ void cPopulationCell::operator=(const cPopulationCell& in_cell)
 		m_cell_id = in_cell.m_cell_id;
 		m_deme_id = in_cell.m_deme_id;
 		m_cell_data = in_cell.m_cell_data;
-		m_spec_state = in_cell.m_spec_state;
     m_can_input = in_cell.m_can_input;
     m_can_output = in_cell.m_can_output;
 		
@@ -111,7 +110,6 @@ void cPopulationCell::Setup(cWorld* world, int in_id, const cMutationRates& in_r
   m_cell_data.org_id = -1;
   m_cell_data.update = -1;
   m_cell_data.territory = -1;
-  m_spec_state = 0;
   
   if (m_mut_rates == NULL)
     m_mut_rates = new cMutationRates(in_rates);
@@ -267,8 +265,13 @@ void cPopulationCell::InsertOrganism(cOrganism* new_org, cAvidaContext& ctx)
   // Adjust this cell's attributes to account for the new organism.
   m_organism = new_org;
   m_hardware = &new_org->GetHardware();
-  m_world->GetStats().AddSpeculativeWaste(m_spec_state);
-  m_spec_state = 0;
+  m_world->GetPopulation().GetOccupancyIndex().Add(cOccupancyIndex::ORGANISMS, m_cell_id, 1);
+  cCellStepState& step_state = m_world->GetPopulation().GetStepState();
+  step_state.SetOccupant(m_cell_id, m_organism, m_hardware);
+  const int spec_state = step_state.GetSpeculativeState(m_cell_id);
+  m_world->GetStats().AddSpeculativeWaste(spec_state);
+  if (spec_state && m_world->GetProfiler().IsEnabled()) m_world->GetProfiler().AddSpeculativeWaste(spec_state);
+  step_state.SetSpeculativeState(m_cell_id, 0);
 	
   // Adjust the organism's attributes to match this cell.
   m_organism->GetOrgInterface().SetCellID(m_cell_id);
@@ -303,6 +306,8 @@ cOrganism * cPopulationCell::RemoveOrganism(cAvidaContext& ctx)
   }
   m_organism = NULL;
   m_hardware = NULL;
+  m_world->GetPopulation().GetOccupancyIndex().Add(cOccupancyIndex::ORGANISMS, m_cell_id, -1);
+  m_world->GetPopulation().GetStepState().SetOccupant(m_cell_id, NULL, NULL);
   return out_organism;
 }
 
@@ -330,6 +335,7 @@ double cPopulationCell::UptakeCellEnergy(double frac_to_uptake, cAvidaContext& c
 void cPopulationCell::AddPredAV(cOrganism* org)
 {
   m_av_pred.Push(org);
+  m_world->GetPopulation().GetOccupancyIndex().Add(cOccupancyIndex::PRED_AVATARS, m_cell_id, 1);
   // Swaps the added avatar into a random position in the array
   int loc = m_world->GetRandom().GetUInt(0, m_av_pred.GetSize());
   cOrganism* exist_org = m_av_pred[loc];
@@ -342,6 +348,7 @@ void cPopulationCell::AddPredAV(cOrganism* org)
 void cPopulationCell::AddPreyAV(cOrganism* org)
 {
   m_av_prey.Push(org);
+  m_world->GetPopulation().GetOccupancyIndex().Add(cOccupancyIndex::PREY_AVATARS, m_cell_id, 1);
   // Swaps the added avatar into a random position in the array
   int loc = m_world->GetRandom().GetUInt(0, m_av_prey.GetSize());
   cOrganism* exist_org = m_av_prey[loc];
@@ -360,6 +367,7 @@ void cPopulationCell::RemovePredAV(cOrganism* org)
   exist_org->SetAVInIndex(org->GetAVInIndex());
   m_av_pred.Swap(org->GetAVInIndex(), last);
   m_av_pred.Pop();
+  m_world->GetPopulation().GetOccupancyIndex().Add(cOccupancyIndex::PRED_AVATARS, m_cell_id, -1);
 }
 
 // Removes the organism from the cell's output avatars (prey)
@@ -372,6 +380,7 @@ void cPopulationCell::RemovePreyAV(cOrganism* org)
   exist_org->SetAVOutIndex(org->GetAVOutIndex());
   m_av_prey.Swap(org->GetAVOutIndex(), last);
   m_av_prey.Pop();
+  m_world->GetPopulation().GetOccupancyIndex().Add(cOccupancyIndex::PREY_AVATARS, m_cell_id, -1);
 }
 
 // Returns whether a cell has an output AV that the org will be able to receive messages from.
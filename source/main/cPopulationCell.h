@@ -68,8 +68,6 @@ private:
     int forager;
   } m_cell_data;         // "data" that is local to the cell and can be retrieaved by the org.
 
-  int m_spec_state;
-
   bool m_migrant; //@AWC -- does the cell contain a migrant genome?
 
   // location in population
@@ -136,10 +134,6 @@ public:
   void SetCellData(int data, int org_id = -1);
   void ClearCellData();
 
-  inline int GetSpeculativeState() const { return m_spec_state; }
-  inline void SetSpeculativeState(int count) { m_spec_state = count; }
-  inline void DecSpeculative() { m_spec_state--; }
-
   inline bool IsOccupied() const { return m_organism != NULL; }
 
   double UptakeCellEnergy(double frac_to_uptake, cAvidaContext& ctx); 
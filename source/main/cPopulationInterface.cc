@@ -77,6 +77,10 @@ const Apto::Array<cOrganism*, Apto::Smart>& cPopulationInterface::GetLiveOrgList
   return m_world->GetPopulation().GetLiveOrgList();
 }
 
+cOrganism* cPopulationInterface::GetLiveOrgByID(int org_id) const {
+  return m_world->GetPopulation().GetLiveOrgByID(org_id);
+}
+
 cPopulationCell* cPopulationInterface::GetCell() { 
 	return &m_world->GetPopulation().GetCell(m_cell_id);
 }
@@ -600,16 +604,12 @@ bool cPopulationInterface::BroadcastMessage(cOrgMessage& msg, int depth) {
   cPopulationCell& cell = m_world->GetPopulation().GetCell(m_cell_id);
   assert(cell.IsOccupied()); // This organism; sanity.
 	
-	// Get the set of cells that are within range.
-	std::set<cPopulationCell*> cell_set;
-	cell.GetNeighboringCells(cell_set, depth);
-	
-	// Remove this cell from the set!
-	cell_set.erase(&cell);
+	// Get the cells that are within range (not including this one).
+	cNeighborhoodTable::Span neighbors = m_world->GetPopulation().GetCellNeighborhood(m_cell_id, depth);
 	
 	// Now, send a message towards each cell:
-	for(std::set<cPopulationCell*>::iterator i=cell_set.begin(); i!=cell_set.end(); ++i) {
-		SendMessage(msg, **i);
+	for (int i = 0; i < neighbors.GetSize(); i++) {
+		SendMessage(msg, m_world->GetPopulation().GetCell(neighbors[i]));
 	}
 	return true;
 }
@@ -624,23 +624,17 @@ bool cPopulationInterface::BcastAlarm(int jump_label, int bcast_range) {
   
   if(bcast_range > 1) { // multi-hop messaging
     cDeme& deme = m_world->GetPopulation().GetDeme(GetDemeID());
-    for(int i = 0; i < deme.GetSize(); i++) {
-      int possible_receiver_id = deme.GetCellID(i);
-      cPopulationCell& rcell = m_world->GetPopulation().GetCell(possible_receiver_id);
+    // cells of the deme within bcast_range grid steps of the sender, not including the sender
+    cNeighborhoodTable::Span in_range = m_world->GetPopulation().GetDemeNeighborhood(GetCellID(), bcast_range);
+    for(int i = 0; i < in_range.GetSize(); i++) {
+      cPopulationCell& rcell = m_world->GetPopulation().GetCell(deme.GetCellID(in_range[i]));
 			
-      if(rcell.IsOccupied() && possible_receiver_id != GetCellID()) {
-        //check distance
-        pair<int, int> sender_pos = deme.GetCellPosition(GetCellID());
-        pair<int, int> possible_receiver_pos = deme.GetCellPosition(possible_receiver_id);
-        int hop_distance = max( abs(sender_pos.first  - possible_receiver_pos.first),
-															 abs(sender_pos.second - possible_receiver_pos.second));
-        if(hop_distance <= bcast_range) {
-          // send alarm to organisms
-          cOrganism* recvr = rcell.GetOrganism();
-          assert(recvr != NULL);
-          recvr->moveIPtoAlarmLabel(jump_label);
-          successfully_sent = true;
-        }
+      if(rcell.IsOccupied()) {
+        // send alarm to organisms
+        cOrganism* recvr = rcell.GetOrganism();
+        assert(recvr != NULL);
+        recvr->moveIPtoAlarmLabel(jump_label);
+        successfully_sent = true;
       }
     }
   } else { // single hop messaging
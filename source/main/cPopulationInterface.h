@@ -60,6 +60,7 @@ public:
   virtual ~cPopulationInterface();
 
   const Apto::Array<cOrganism*, Apto::Smart>& GetLiveOrgList() const;
+  cOrganism* GetLiveOrgByID(int org_id) const;
 	//! Retrieve this organism.
 	cOrganism* GetOrganism();
 	//! Retrieve the ID of this cell.
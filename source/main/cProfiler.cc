@@ -0,0 +1,184 @@
+/*
+ *  cProfiler.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cProfiler.h"
+
+#include "avida/data/Package.h"
+
+#include "cHardwareManager.h"
+#include "cInstSet.h"
+#include "cWorld.h"
+
+
+cInstProfile::cInstProfile(int num_inst, int sample_interval)
+  : m_exec_counts(num_inst), m_sample_cycles(num_inst), m_sample_counts(num_inst)
+  , m_sample_interval(sample_interval), m_sample_countdown(sample_interval)
+{
+  m_exec_counts.SetAll(0);
+  m_sample_cycles.SetAll(0);
+  m_sample_counts.SetAll(0);
+}
+
+
+cProfiler::cProfiler(cWorld* world)
+  : m_world(world)
+  , m_enabled(world->GetConfig().PROFILE_EXECUTION.Get())
+  , m_spec_executed(0), m_spec_rollbacks(0), m_spec_wasted(0)
+  , m_provides(new Data::DataSet)
+{
+  for (int i = 0; i < NUM_PHASES; i++) {
+    m_phase_cycles[i] = 0;
+    m_last_phase_cycles[i] = 0;
+    m_total_phase_cycles[i] = 0;
+  }
+
+  int sample_interval = world->GetConfig().PROFILE_SAMPLE_INTERVAL.Get();
+  if (sample_interval < 1) sample_interval = 1;
+
+  cHardwareManager& hwm = world->GetHardwareManager();
+  m_inst_profiles.Resize(hwm.GetNumInstSets());
+  for (int i = 0; i < hwm.GetNumInstSets(); i++) {
+    m_inst_profiles[i] = new cInstProfile(hwm.GetInstSet(i).GetSize(), sample_interval);
+  }
+
+  m_provides->Insert("core.profile.inst_exec_counts[]");
+  m_provides->Insert("core.profile.inst_cycles[]");
+  m_provides->Insert("core.profile.update_cycles[]");
+  m_provides->Insert("core.profile.speculative[]");
+}
+
+
+cProfiler::~cProfiler()
+{
+  for (int i = 0; i < m_inst_profiles.GetSize(); i++) delete m_inst_profiles[i];
+}
+
+
+cInstProfile* cProfiler::GetInstProfile(const cInstSet* inst_set)
+{
+  if (!m_enabled) return NULL;
+
+  cHardwareManager& hwm = m_world->GetHardwareManager();
+  for (int i = 0; i < hwm.GetNumInstSets(); i++) {
+    if (&hwm.GetInstSet(i) == inst_set) return m_inst_profiles[i];
+  }
+  return NULL;
+}
+
+
+void cProfiler::UpdateComplete()
+{
+  for (int i = 0; i < NUM_PHASES; i++) {
+    m_last_phase_cycles[i] = m_phase_cycles[i];
+    m_total_phase_cycles[i] += m_phase_cycles[i];
+    m_phase_cycles[i] = 0;
+  }
+}
+
+
+const char* cProfiler::GetPhaseName(ePhase phase)
+{
+  switch (phase) {
+    case PHASE_EXECUTE:   return "execute";
+    case PHASE_BIRTHS:    return "births";
+    case PHASE_RESOURCES: return "resources";
+    case PHASE_STATS:     return "stats";
+    default:              return "";
+  }
+}
+
+
+Apto::String cProfiler::DescribeProvidedValue(const Data::DataID& data_id) const
+{
+  Apto::String rtn;
+  if (data_id == "core.profile.inst_exec_counts[]") {
+    rtn = "Cumulative population instruction execution counts for the specified instruction set.";
+  } else if (data_id == "core.profile.inst_cycles[]") {
+    rtn = "Average sampled cycles per executed instruction for the specified instruction set.";
+  } else if (data_id == "core.profile.update_cycles[]") {
+    rtn = "Cycles spent in the specified phase (execute, births, resources, stats) during the last update.";
+  } else if (data_id == "core.profile.speculative[]") {
+    rtn = "Cumulative speculative execution counts (executed, rollbacks, wasted).";
+  }
+  return rtn;
+}
+
+
+Data::ConstArgumentSetPtr cProfiler::GetValidArguments(const Data::DataID& data_id) const
+{
+  Data::ArgumentSetPtr args(new Data::ArgumentSet);
+
+  if (data_id == "core.profile.update_cycles[]") {
+    for (int i = 0; i < NUM_PHASES; i++) args->Insert(GetPhaseName((ePhase)i));
+  } else if (data_id == "core.profile.speculative[]") {
+    args->Insert("executed");
+    args->Insert("rollbacks");
+    args->Insert("wasted");
+  } else {
+    cHardwareManager& hwm = m_world->GetHardwareManager();
+    for (int i = 0; i < hwm.GetNumInstSets(); i++) {
+      args->Insert(Apto::String((const char*)hwm.GetInstSet(i).GetInstSetName()));
+    }
+  }
+
+  return args;
+}
+
+
+bool cProfiler::IsValidArgument(const Data::DataID& data_id, Data::Argument arg) const
+{
+  return GetValidArguments(data_id)->Has(arg);
+}
+
+
+Data::PackagePtr cProfiler::GetProvidedValueForArgument(const Data::DataID& data_id, const Data::Argument& arg) const
+{
+  if (data_id == "core.profile.update_cycles[]") {
+    for (int i = 0; i < NUM_PHASES; i++) {
+      if (arg == GetPhaseName((ePhase)i)) return Data::PackagePtr(new Data::Wrap<double>(m_last_phase_cycles[i]));
+    }
+    return Data::PackagePtr();
+  }
+
+  if (data_id == "core.profile.speculative[]") {
+    double value = 0.0;
+    if (arg == "executed") value = m_spec_executed;
+    else if (arg == "rollbacks") value = m_spec_rollbacks;
+    else if (arg == "wasted") value = m_spec_wasted;
+    return Data::PackagePtr(new Data::Wrap<double>(value));
+  }
+
+  Apto::SmartPtr<Data::ArrayPackage, Apto::InternalRCObject> pkg(new Data::ArrayPackage);
+
+  cHardwareManager& hwm = m_world->GetHardwareManager();
+  for (int is = 0; is < hwm.GetNumInstSets(); is++) {
+    if (arg != (const char*)hwm.GetInstSet(is).GetInstSetName()) continue;
+
+    const cInstProfile& profile = *m_inst_profiles[is];
+    for (int i = 0; i < profile.GetSize(); i++) {
+      double value = (data_id == "core.profile.inst_cycles[]") ? profile.GetAveSampleCycles(i) : profile.GetExecCount(i);
+      pkg->AddComponent(Data::PackagePtr(new Data::Wrap<double>(value)));
+    }
+    break;
+  }
+
+  return pkg;
+}
@@ -0,0 +1,169 @@
+/*
+ *  cProfiler.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cProfiler_h
+#define cProfiler_h
+
+#include "avida/data/Provider.h"
+
+#include <ctime>
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+class cInstSet;
+class cWorld;
+
+using namespace Avida;
+
+
+// cInstProfile - per instruction set execution counters
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Population hardware holds a pointer to the profile for its instruction set (see cHardwareBase::SetInstProfile),
+//  so the per-instruction cost is a single counter increment plus a countdown for the timing sample.
+
+class cInstProfile
+{
+public:
+  typedef unsigned long long Cycles;
+
+private:
+  Apto::Array<unsigned long long> m_exec_counts;
+  Apto::Array<Cycles> m_sample_cycles;
+  Apto::Array<unsigned long long> m_sample_counts;
+  int m_sample_interval;
+  int m_sample_countdown;
+
+  cInstProfile(); // @not_implemented
+  cInstProfile(const cInstProfile&); // @not_implemented
+  cInstProfile& operator=(const cInstProfile&); // @not_implemented
+
+public:
+  cInstProfile(int num_inst, int sample_interval);
+
+  static inline Cycles ReadCycles();
+
+  inline void CountInst(int op) { m_exec_counts[op]++; }
+  inline bool SampleNext();
+  inline void AddSample(int op, Cycles cycles) { m_sample_cycles[op] += cycles; m_sample_counts[op]++; }
+
+  int GetSize() const { return m_exec_counts.GetSize(); }
+  unsigned long long GetExecCount(int op) const { return m_exec_counts[op]; }
+  unsigned long long GetSampleCount(int op) const { return m_sample_counts[op]; }
+  double GetAveSampleCycles(int op) const
+    { return (m_sample_counts[op]) ? (double)m_sample_cycles[op] / (double)m_sample_counts[op] : 0.0; }
+};
+
+
+// cProfiler - world level execution profile, also provides the profile to the data manager
+// --------------------------------------------------------------------------------------------------------------
+//
+//  When PROFILE_EXECUTION is off no hardware is handed an instruction profile and cPopulation does not read the
+//  cycle counter, so the only cost is a pointer test per instruction and per step.
+
+class cProfiler : public Data::ArgumentedProvider
+{
+public:
+  enum ePhase {
+    PHASE_EXECUTE = 0, // organism execution, including births
+    PHASE_BIRTHS,      // offspring activation (nested within execute)
+    PHASE_RESOURCES,   // resource and deme updates
+    PHASE_STATS,       // end of update statistics
+    NUM_PHASES
+  };
+
+private:
+  cWorld* m_world;
+  bool m_enabled;
+  Apto::Array<cInstProfile*> m_inst_profiles;    // indexed by the hardware manager instruction set id
+
+  cInstProfile::Cycles m_phase_cycles[NUM_PHASES];
+  cInstProfile::Cycles m_last_phase_cycles[NUM_PHASES];
+  cInstProfile::Cycles m_total_phase_cycles[NUM_PHASES];
+
+  unsigned long long m_spec_executed;
+  unsigned long long m_spec_rollbacks;
+  unsigned long long m_spec_wasted;
+
+  Data::DataSetPtr m_provides;
+
+
+  cProfiler(); // @not_implemented
+  cProfiler(const cProfiler&); // @not_implemented
+  cProfiler& operator=(const cProfiler&); // @not_implemented
+
+public:
+  cProfiler(cWorld* world);
+  ~cProfiler();
+
+  bool IsEnabled() const { return m_enabled; }
+
+  cInstProfile* GetInstProfile(const cInstSet* inst_set);
+  const cInstProfile* GetInstProfile(int inst_set_id) const { return m_inst_profiles[inst_set_id]; }
+
+  inline void AddPhaseCycles(ePhase phase, cInstProfile::Cycles cycles) { m_phase_cycles[phase] += cycles; }
+  void UpdateComplete();
+  cInstProfile::Cycles GetLastPhaseCycles(ePhase phase) const { return m_last_phase_cycles[phase]; }
+  cInstProfile::Cycles GetTotalPhaseCycles(ePhase phase) const { return m_total_phase_cycles[phase]; }
+  static const char* GetPhaseName(ePhase phase);
+
+  inline void AddSpeculative(int executed, bool rollback) { m_spec_executed += executed; if (rollback) m_spec_rollbacks++; }
+  inline void AddSpeculativeWaste(int wasted) { m_spec_wasted += wasted; }
+  unsigned long long GetSpeculativeExecuted() const { return m_spec_executed; }
+  unsigned long long GetSpeculativeRollbacks() const { return m_spec_rollbacks; }
+  unsigned long long GetSpeculativeWasted() const { return m_spec_wasted; }
+
+  // Data::ArgumentedProvider
+  Data::ConstDataSetPtr Provides() const { return m_provides; }
+  void UpdateProvidedValues(Update current_update) { (void)current_update; }
+  Apto::String DescribeProvidedValue(const Data::DataID& data_id) const;
+
+  void SetActiveArguments(const Data::DataID& data_id, Data::ConstArgumentSetPtr args) { (void)data_id; (void)args; }
+  Data::ConstArgumentSetPtr GetValidArguments(const Data::DataID& data_id) const;
+  bool IsValidArgument(const Data::DataID& data_id, Data::Argument arg) const;
+
+  Data::PackagePtr GetProvidedValueForArgument(const Data::DataID& data_id, const Data::Argument& arg) const;
+};
+
+
+inline cInstProfile::Cycles cInstProfile::ReadCycles()
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+  unsigned int lo, hi;
+  __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((Cycles)hi << 32) | lo;
+#elif defined(_MSC_VER)
+  return __rdtsc();
+#else
+  return std::clock();
+#endif
+}
+
+inline bool cInstProfile::SampleNext()
+{
+  if (--m_sample_countdown > 0) return false;
+  m_sample_countdown = m_sample_interval;
+  return true;
+}
+
+#endif
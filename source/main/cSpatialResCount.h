@@ -65,8 +65,8 @@ public:
   cSpatialCountElem& Element(int x) { return grid[x]; }
   void Rate(int x, double ratein) const;
   void Rate(int x, int y, double ratein) const;
-  void State(int x);
-  void State(int x, int y);
+  virtual void State(int x);
+  virtual void State(int x, int y);
   double GetAmount(int x) const;
   double GetAmount(int x, int y) const;
   void RateAll(double ratein); 
@@ -77,7 +77,7 @@ public:
   void CellInflow() const;
   void Sink(double percent) const;
   void CellOutflow() const;
-  void SetCellAmount(int cell_id, double res);
+  virtual void SetCellAmount(int cell_id, double res);
   void SetInitial(double initial) { m_initial = initial; }
   double GetInitial() const { return m_initial; }
   void SetGeometry(int in_geometry) { geometry = in_geometry; }
@@ -94,7 +94,7 @@ public:
   void SetOutflowY1(int in_outflowY1) { outflowY1 = in_outflowY1; }
   void SetOutflowY2(int in_outflowY2) { outflowY2 = in_outflowY2; }
   virtual void UpdateCount(cAvidaContext&) { ; }
-  void ResetResourceCounts();
+  virtual void ResetResourceCounts();
   void SetModified(bool in_modified) { m_modified = in_modified; }
   bool GetModified() { return m_modified; }
   
@@ -292,6 +292,34 @@ Data::PackagePtr cStats::GetProvidedValueForArgument(const Apto::String& data_id
   return rtn;
 }
 
+int cStats::ResolveProvidedSlot(const Data::DataID& data_id, Data::ValueType& type) const
+{
+  ProvidedData data_entry;
+  if (!m_provided_data.Get(data_id, data_entry) || data_entry.slot < 0) {
+    type = Data::VALUE_PACKAGE;
+    return -1;
+  }
+  if (data_id.GetSize() > 16 && data_id.Substring(0, 16) == "core.environment") {
+    m_collect_env_test_stats = true;
+  }
+  type = m_typed_slots[data_entry.slot].type;
+  return data_entry.slot;
+}
+
+int cStats::ProvidedIntValue(int slot) const
+{
+  const TypedSlot& typed_slot = m_typed_slots[slot];
+  assert(typed_slot.type == Data::VALUE_INT);
+  return (typed_slot.int_func) ? (this->*typed_slot.int_func)() : GetTaskTestCount(typed_slot.task_id);
+}
+
+double cStats::ProvidedDoubleValue(int slot) const
+{
+  const TypedSlot& typed_slot = m_typed_slots[slot];
+  assert(typed_slot.type == Data::VALUE_DOUBLE);
+  return (this->*typed_slot.double_func)();
+}
+
 Apto::String cStats::DescribeProvidedValue(const Apto::String& data_id) const
 {
   ProvidedData data_entry;
@@ -341,6 +369,28 @@ template <class T, class U> Data::PackagePtr cStats::packageArgData(T (cStats::*
 }
 
 
+int cStats::addTypedSlot(int (cStats::*func)() const)
+{
+  TypedSlot slot = { Data::VALUE_INT, func, NULL, -1 };
+  m_typed_slots.Push(slot);
+  return m_typed_slots.GetSize() - 1;
+}
+
+int cStats::addTypedSlot(double (cStats::*func)() const)
+{
+  TypedSlot slot = { Data::VALUE_DOUBLE, NULL, func, -1 };
+  m_typed_slots.Push(slot);
+  return m_typed_slots.GetSize() - 1;
+}
+
+int cStats::addTaskTestSlot(int task_id)
+{
+  TypedSlot slot = { Data::VALUE_INT, NULL, NULL, task_id };
+  m_typed_slots.Push(slot);
+  return m_typed_slots.GetSize() - 1;
+}
+
+
 void cStats::setupProvidedData()
 {
   // Load in all the keywords, descriptions, and associated functions for
@@ -354,7 +404,7 @@ void cStats::setupProvidedData()
   
   // Define PROVIDE macro to simplify instantiating new provided data
 #define PROVIDE(name, desc, type, func) { \
-m_provided_data[name] = ProvidedData(desc, Apto::BindFirst(type ## Stat, &cStats::func));\
+m_provided_data[name] = ProvidedData(desc, Apto::BindFirst(type ## Stat, &cStats::func), addTypedSlot(&cStats::func));\
 mgr->Register(name, activate); \
 }
   
@@ -432,7 +482,7 @@ mgr->Register(name, activate); \
     Apto::String task_id(Apto::FormatStr("core.environment.triggers.%s.test_organisms", (const char*)env.GetTask(i).GetName()));
     Apto::String task_desc(task_names[i]);
     
-    m_provided_data[task_id] = ProvidedData(task_desc, Apto::BindFirst(taskLastCount, i));
+    m_provided_data[task_id] = ProvidedData(task_desc, Apto::BindFirst(taskLastCount, i), addTaskTestSlot(i));
     mgr->Register(task_id, activate);
 	}
   
@@ -98,12 +98,21 @@ private:
   {
     Apto::String description;
     Apto::Functor<Data::PackagePtr, Apto::NullType> GetData;
+    int slot;
     
-    ProvidedData() { ; }
-    ProvidedData(const Apto::String& desc, Apto::Functor<Data::PackagePtr, Apto::NullType> func)
-      : description(desc), GetData(func) { ; } 
+    ProvidedData() : slot(-1) { ; }
+    ProvidedData(const Apto::String& desc, Apto::Functor<Data::PackagePtr, Apto::NullType> func, int in_slot)
+      : description(desc), GetData(func), slot(in_slot) { ; } 
+  };
+  struct TypedSlot
+  {
+    Data::ValueType type;
+    int (cStats::*int_func)() const;
+    double (cStats::*double_func)() const;
+    int task_id;                                  // task test count when both functions are NULL
   };
   Apto::Map<Apto::String, ProvidedData> m_provided_data;
+  Apto::Array<TypedSlot> m_typed_slots;
   mutable Data::ConstDataSetPtr m_provides;
 
 
@@ -393,6 +402,9 @@ public:
   Data::ConstDataSetPtr Provides() const;
   void UpdateProvidedValues(Update current_update);
   Apto::String DescribeProvidedValue(const Apto::String& data_id) const;
+  int ResolveProvidedSlot(const Data::DataID& data_id, Data::ValueType& type) const;
+  int ProvidedIntValue(int slot) const;
+  double ProvidedDoubleValue(int slot) const;
 
   // Data::ArgumentedProvider
   void SetActiveArguments(const Data::DataID& data_id, Data::ConstArgumentSetPtr args);
@@ -1251,6 +1263,9 @@ private:
   // Helper Methods
   template <class T> Data::PackagePtr packageData(T (cStats::*)() const) const;
   template <class T, class U> Data::PackagePtr packageArgData(T (cStats::*)(U arg) const, U arg) const;
+  int addTypedSlot(int (cStats::*func)() const);
+  int addTypedSlot(double (cStats::*func)() const);
+  int addTaskTestSlot(int task_id);
 };
 
 
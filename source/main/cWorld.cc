@@ -34,12 +34,14 @@
 
 #include "cAnalyze.h"
 #include "cAnalyzeGenotype.h"
+#include "cAnalyzeJobQueue.h"
 #include "cEnvironment.h"
 #include "cEventList.h"
 #include "cHardwareManager.h"
 #include "cMigrationMatrix.h"  
 #include "cInstSet.h"
 #include "cPopulation.h"
+#include "cProfiler.h"
 #include "cStats.h"
 #include "cTestCPU.h"
 #include "cUserFeedback.h"
@@ -50,8 +52,8 @@ using namespace AvidaTools;
 
 
 cWorld::cWorld(cAvidaConfig* cfg, const cString& wd)
-  : m_working_dir(wd), m_analyze(NULL), m_conf(cfg), m_ctx(NULL)
-  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL), m_pop(NULL), m_stats(NULL), m_mig_mat(NULL), m_driver(NULL), m_data_mgr(NULL)
+  : m_working_dir(wd), m_analyze(NULL), m_job_queue(NULL), m_conf(cfg), m_ctx(NULL)
+  , m_env(NULL), m_event_list(NULL), m_hw_mgr(NULL), m_pop(NULL), m_stats(NULL), m_profiler(NULL), m_mig_mat(NULL), m_driver(NULL), m_data_mgr(NULL)
   , m_own_driver(false)
 {
 }
@@ -72,6 +74,7 @@ cWorld::~cWorld()
   
   // These must be deleted first
   delete m_analyze; m_analyze = NULL;
+  delete m_job_queue; m_job_queue = NULL;
   
   // Forcefully clean up population before classification manager
   m_pop = Apto::SmartPtr<cPopulation, Apto::InternalRCObject>();
@@ -115,7 +118,9 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
     
     // Output Manager
     Apto::String opath = Apto::FileSystem::GetAbsolutePath(Apto::String(m_conf->DATA_DIR.Get()), Apto::String(m_working_dir));
-    Output::ManagerPtr(new Output::Manager(opath))->AttachTo(new_world);
+    Output::ManagerPtr output_mgr(new Output::Manager(opath));
+    output_mgr->AttachTo(new_world);
+    if (m_conf->ASYNC_OUTPUT.Get()) output_mgr->EnableAsyncOutput(m_conf->ASYNC_OUTPUT_QUEUE_SIZE.Get() * 1024);
   }
   
 
@@ -172,6 +177,17 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
   if (!success) return success;
   
   
+  // Setup Execution Profile, must follow the instruction sets and precede the population
+  m_profiler = Apto::SmartPtr<cProfiler, Apto::InternalRCObject>(new cProfiler(this));
+  {
+    Data::ArgumentedProviderActivateFunctor activate(this, &cWorld::GetProfilerProvider);
+    m_data_mgr->Register("core.profile.inst_exec_counts[]", activate);
+    m_data_mgr->Register("core.profile.inst_cycles[]", activate);
+    m_data_mgr->Register("core.profile.update_cycles[]", activate);
+    m_data_mgr->Register("core.profile.speculative[]", activate);
+  }
+  
+  
   // @MRR CClade Tracking
 //	if (m_conf->TRACK_CCLADES.Get() > 0)
 //		m_class_mgr->LoadCCladeFounders(m_conf->TRACK_CCLADES_IDS.Get());
@@ -206,6 +222,7 @@ bool cWorld::setup(World* new_world, cUserFeedback* feedback, const Apto::Map<Ap
 
 Data::ProviderPtr cWorld::GetStatsProvider(World*) { return m_stats; }
 Data::ArgumentedProviderPtr cWorld::GetPopulationProvider(World*) { return m_pop; }
+Data::ArgumentedProviderPtr cWorld::GetProfilerProvider(World*) { return m_profiler; }
 
 
 cAnalyze& cWorld::GetAnalyze()
@@ -214,6 +231,14 @@ cAnalyze& cWorld::GetAnalyze()
   return *m_analyze;
 }
 
+// Creating the job queue does not draw on the world RNG, so run mode code may start using it at any time without
+// changing the rest of the run
+cAnalyzeJobQueue& cWorld::GetJobQueue()
+{
+  if (m_job_queue == NULL) m_job_queue = new cAnalyzeJobQueue(this);
+  return *m_job_queue;
+}
+
 void cWorld::GetEvents(cAvidaContext& ctx)
 {  
   if (m_pop->GetSyncEvents() == true) {
@@ -33,6 +33,7 @@
 #include <cassert>
 
 class cAnalyze;
+class cAnalyzeJobQueue;
 class cAnalyzeGenotype;
 class cEnvironment;
 class cEventList;
@@ -42,6 +43,7 @@ class cOrganism;
 class cPopulation;
 class cMerit;
 class cPopulationCell;
+class cProfiler;
 class cStats;
 class cTestCPU;
 class cUserFeedback;
@@ -57,6 +59,7 @@ protected:
   cString m_working_dir;
   
   cAnalyze* m_analyze;
+  cAnalyzeJobQueue* m_job_queue;
   cAvidaConfig* m_conf;
   cAvidaContext* m_ctx;
   cEnvironment* m_env;
@@ -64,6 +67,7 @@ protected:
   cHardwareManager* m_hw_mgr;
   Apto::SmartPtr<cPopulation, Apto::InternalRCObject> m_pop;
   Apto::SmartPtr<cStats, Apto::InternalRCObject> m_stats;
+  Apto::SmartPtr<cProfiler, Apto::InternalRCObject> m_profiler;
   cMigrationMatrix* m_mig_mat;  
   WorldDriver* m_driver;
   
@@ -90,6 +94,7 @@ public:
   
   // General Object Accessors
   cAnalyze& GetAnalyze();
+  cAnalyzeJobQueue& GetJobQueue();
   cAvidaConfig& GetConfig() { return *m_conf; }
   cAvidaContext& GetDefaultContext() { return *m_ctx; }
   cEnvironment& GetEnvironment() { return *m_env; }
@@ -99,6 +104,7 @@ public:
   Apto::Random& GetRandom() { return m_rng; }
   Apto::Random& GetRandomSample() { return m_srng; }
   cStats& GetStats() { return *m_stats; }
+  cProfiler& GetProfiler() { return *m_profiler; }
   WorldDriver& GetDriver() { return *m_driver; }
   World* GetNewWorld() { return m_new_world; }
   
@@ -106,6 +112,7 @@ public:
   
   Data::ProviderPtr GetStatsProvider(World*);
   Data::ArgumentedProviderPtr GetPopulationProvider(World*);
+  Data::ArgumentedProviderPtr GetProfilerProvider(World*);
   
   // Config Dependent Modes
   bool GetTestOnDivide() const { return m_test_on_div; }
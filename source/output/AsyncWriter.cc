@@ -0,0 +1,166 @@
+/*
+ *  output/AsyncWriter.cc
+ *  avida-core
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/private/output/AsyncWriter.h"
+
+
+Avida::Output::AsyncWriter::AsyncWriter(size_t max_queued_bytes)
+  : m_thread(NULL), m_queued_bytes(0), m_max_queued_bytes(max_queued_bytes), m_submitted(0), m_completed(0)
+  , m_shutdown(false), m_error_pending(false)
+{
+  m_thread = new WriterThread(this);
+  m_thread->Start();
+}
+
+Avida::Output::AsyncWriter::~AsyncWriter()
+{
+  Shutdown();
+}
+
+
+Avida::Output::AsyncWriter::Ticket Avida::Output::AsyncWriter::Submit(std::ofstream* fp, const OutputID& name,
+                                                                      std::string& data)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+
+  if (m_shutdown) {
+    // Writer thread is gone, write through (still in order, since the queue was drained on shutdown)
+    fp->write(data.data(), data.size());
+    fp->flush();
+    if (fp->fail() && m_failed.insert(fp).second && !m_error.GetSize()) {
+      m_error = Apto::FormatStr("unable to write to '%s'", (const char*)name);
+      m_error_pending = true;
+    }
+    data.clear();
+    m_completed = ++m_submitted;
+    return m_submitted;
+  }
+
+  // Bounded queue, wait for the writer to catch up (always admit at least one chunk so oversized data progresses)
+  while (m_queued_bytes > 0 && m_queued_bytes + data.size() > m_max_queued_bytes) m_space_cond.Wait(m_mutex);
+
+  m_pending.push_back(Chunk());
+  Chunk& chunk = m_pending.back();
+  chunk.fp = fp;
+  chunk.name = name;
+  chunk.data.swap(data);
+  m_queued_bytes += chunk.data.size();
+
+  m_work_cond.Signal();
+  return ++m_submitted;
+}
+
+
+void Avida::Output::AsyncWriter::Sync(Ticket ticket)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  while (m_completed < ticket) m_done_cond.Wait(m_mutex);
+}
+
+void Avida::Output::AsyncWriter::SyncAll()
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  while (m_completed < m_submitted) m_done_cond.Wait(m_mutex);
+}
+
+
+bool Avida::Output::AsyncWriter::HasFailed(const std::ofstream* fp) const
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  return (m_failed.find(fp) != m_failed.end());
+}
+
+void Avida::Output::AsyncWriter::Release(const std::ofstream* fp)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  m_failed.erase(fp);
+}
+
+
+bool Avida::Output::AsyncWriter::TakeError(Apto::String& message)
+{
+  Apto::MutexAutoLock lock(m_mutex);
+  if (!m_error_pending) return false;
+
+  message = m_error;
+  m_error_pending = false;
+  return true;
+}
+
+
+void Avida::Output::AsyncWriter::Shutdown()
+{
+  m_mutex.Lock();
+  if (m_shutdown) {
+    m_mutex.Unlock();
+    return;
+  }
+  m_shutdown = true;
+  m_work_cond.Signal();
+  m_mutex.Unlock();
+
+  m_thread->Join();
+  delete m_thread;
+  m_thread = NULL;
+}
+
+
+void Avida::Output::AsyncWriter::run()
+{
+  std::vector<Chunk> active;
+
+  while (true) {
+    m_mutex.Lock();
+    while (m_pending.empty() && !m_shutdown) m_work_cond.Wait(m_mutex);
+    if (m_pending.empty()) {
+      // Shutdown requested and nothing left to write
+      m_mutex.Unlock();
+      break;
+    }
+    active.swap(m_pending);
+    m_mutex.Unlock();
+
+    // Write the batch without holding the lock, so that the simulation can keep filling the pending buffer
+    size_t bytes = 0;
+    for (size_t i = 0; i < active.size(); i++) {
+      Chunk& chunk = active[i];
+      chunk.fp->write(chunk.data.data(), chunk.data.size());
+      chunk.fp->flush();
+      bytes += chunk.data.size();
+    }
+
+    m_mutex.Lock();
+    for (size_t i = 0; i < active.size(); i++) {
+      if (active[i].fp->fail() && m_failed.insert(active[i].fp).second && !m_error.GetSize()) {
+        m_error = Apto::FormatStr("unable to write to '%s'", (const char*)active[i].name);
+        m_error_pending = true;
+      }
+    }
+    m_queued_bytes -= bytes;
+    m_completed += active.size();
+    m_space_cond.Broadcast();
+    m_done_cond.Broadcast();
+    m_mutex.Unlock();
+
+    active.clear();
+  }
+}
@@ -27,6 +27,12 @@
 #include "avida/core/Feedback.h"
 #include "avida/output/Manager.h"
 
+#include "avida/private/output/AsyncWriter.h"
+
+
+// Buffered bytes that trigger a hand off to the asynchronous writer at the end of a row
+static const std::streamoff ASYNC_SUBMIT_THRESHOLD = 64 * 1024;
+
 
 Avida::Output::FilePtr Avida::Output::File::createWithPath(World* world, Apto::String path, bool append, Feedback* feedback)
 {
@@ -87,13 +93,41 @@ Avida::Output::FilePtr Avida::Output::File::StaticWithPath(World* world, Apto::S
 
 
 Avida::Output::File::File(World* world, const OutputID& name, bool append)
-  : Socket(world, name), m_descr_written(false), m_num_cols(0)
+  : Socket(world, name), m_descr_written(false), m_num_cols(0), m_ticket(0), m_async(false), m_out(&m_fp)
 {
   m_fp.open(name, (append) ? (std::ios::out | std::ios::app) : std::ios::out);
   assert(m_fp.good());
+  
+  m_writer = Output::Manager::Of(world)->AsyncOutputWriter();
+  if (m_writer && m_fp.good()) {
+    m_async = true;
+    m_out = &m_buffer;
+  }
 }
 
-Avida::Output::File::~File() { ; }
+Avida::Output::File::~File()
+{
+  if (m_writer) {
+    if (m_async) {
+      submitBuffer();
+      m_writer->Sync(m_ticket);
+    }
+    m_writer->Release(&m_fp);
+  }
+}
+
+
+bool Avida::Output::File::Fail() const
+{
+  if (m_writer && m_writer->HasFailed(&m_fp)) return true;
+  return (!m_async && m_fp.fail());
+}
+
+bool Avida::Output::File::Good() const
+{
+  if (m_writer && m_writer->HasFailed(&m_fp)) return false;
+  return (m_async || m_fp.good());
+}
 
 
 
@@ -103,7 +137,7 @@ void Avida::Output::File::Write(double x, const char* descr, const char* format)
     m_data << x << " ";
     WriteColumnDesc(descr, format);
   } else {
-    m_fp << x << " ";
+    *m_out << x << " ";
   }
 }
 
@@ -114,7 +148,7 @@ void Avida::Output::File::Write(int i, const char* descr, const char* format)
     m_data << i << " ";
     WriteColumnDesc(descr, format);
   } else {
-    m_fp << i << " ";
+    *m_out << i << " ";
   }
 }
 
@@ -125,7 +159,7 @@ void Avida::Output::File::Write(long i, const char* descr, const char* format)
     m_data << i << " ";
     WriteColumnDesc(descr, format);
   } else {
-    m_fp << i << " ";
+    *m_out << i << " ";
   }
 }
 
@@ -135,7 +169,7 @@ void Avida::Output::File::Write(unsigned int i, const char* descr, const char*)
     m_data << i << " ";
     WriteColumnDesc(descr);
   } else {
-    m_fp << i << " ";
+    *m_out << i << " ";
   }
 }
 
@@ -146,7 +180,7 @@ void Avida::Output::File::Write(const char* data_str, const char* descr, const c
     m_data << data_str << " ";
     WriteColumnDesc(descr, format);
   } else {
-    m_fp << data_str << " ";
+    *m_out << data_str << " ";
   }
 }
 
@@ -160,7 +194,7 @@ void Avida::Output::File::Write(Apto::Array<int> list, const char* descr, const
     WriteColumnDesc(descr, format);
   } else {
     for (int i =0; i < (int)list.GetSize(); i++) {
-      m_fp << list[i] << " ";
+      *m_out << list[i] << " ";
     }
   }
 }
@@ -168,14 +202,14 @@ void Avida::Output::File::Write(Apto::Array<int> list, const char* descr, const
 
 void Avida::Output::File::WriteBlockElement(double x, int element, int x_size)
 {
-  m_fp << x << " ";
-  if (((element + 1) % x_size) == 0) m_fp << "\n";
+  *m_out << x << " ";
+  if (((element + 1) % x_size) == 0) *m_out << "\n";
 }
 
 void Avida::Output::File::WriteBlockElement(int i, int element, int x_size)
 {
-  m_fp << i << " ";
-  if (((element + 1) % x_size) == 0) m_fp << "\n";
+  *m_out << i << " ";
+  if (((element + 1) % x_size) == 0) *m_out << "\n";
 }
 
 void Avida::Output::File::WriteColumnDesc(const char* descr, const char* format)
@@ -201,7 +235,7 @@ void Avida::Output::File::WriteRawComment(const char* comment)
 
 void Avida::Output::File::WriteRaw(const char* str)
 {
-  m_fp << str << "\n";
+  *m_out << str << "\n";
 }
 
 
@@ -218,7 +252,7 @@ void Avida::Output::File::WriteTimeStamp()
 void Avida::Output::File::FlushComments()
 {
   if (!m_descr_written) {
-    m_fp << m_descr;
+    *m_out << m_descr;
     m_descr = "";
     
     m_descr_written = true;
@@ -231,19 +265,22 @@ void Avida::Output::File::Endl()
 {
   if (!m_descr_written) {
     // Handle filetype and format first
-    if (m_filetype != "") m_fp << "#filetype " << m_filetype << std::endl;
-    if (m_format != "") m_fp << "#format " << m_format << std::endl;
+    if (m_filetype != "") *m_out << "#filetype " << m_filetype << std::endl;
+    if (m_format != "") *m_out << "#format " << m_format << std::endl;
     
     // Output column descriptions and comments
-    m_fp << m_descr << std::endl;
+    *m_out << m_descr << std::endl;
     m_descr = "";
     
     // Print the first row of data
-    m_fp << m_data.str() << std::endl;
+    *m_out << m_data.str() << std::endl;
     m_data.clear();
     m_data.str("");
     
     m_descr_written = true;
+  } else if (m_async) {
+    m_buffer << '\n';
+    if (m_buffer.tellp() >= ASYNC_SUBMIT_THRESHOLD) submitBuffer();
   } else {
     m_fp << std::endl;
   }
@@ -252,5 +289,25 @@ void Avida::Output::File::Endl()
 
 void Avida::Output::File::Flush()
 {
-  m_fp.flush();
+  if (m_async) submitBuffer();
+  else m_fp.flush();
+}
+
+
+void Avida::Output::File::submitBuffer()
+{
+  std::string data(m_buffer.str());
+  if (data.size() == 0) return;
+  
+  m_buffer.str("");
+  m_ticket = m_writer->Submit(&m_fp, m_output_id, data);
+}
+
+void Avida::Output::File::stopAsync()
+{
+  submitBuffer();
+  m_writer->Sync(m_ticket);
+  
+  m_async = false;
+  m_out = &m_fp;
 }
@@ -24,8 +24,13 @@
 
 #include "avida/output/Manager.h"
 
+#include "avida/core/Context.h"
+#include "avida/core/Feedback.h"
+#include "avida/core/WorldDriver.h"
 #include "avida/output/Socket.h"
 
+#include "avida/private/output/AsyncWriter.h"
+
 Avida::Output::Manager::Manager(const Apto::String& output_path) : m_world(NULL)
 {
   m_output_path = output_path;
@@ -112,6 +117,22 @@ void Avida::Output::Manager::FlushAll()
     (*it.Get())->Flush();
   }
   m_mutex.Unlock();
+  
+  if (m_async_writer) m_async_writer->SyncAll();
+}
+
+
+bool Avida::Output::Manager::EnableAsyncOutput(int max_queued_bytes)
+{
+  if (m_async_writer || max_queued_bytes <= 0) return false;
+  
+  m_async_writer = AsyncWriterPtr(new AsyncWriter(max_queued_bytes));
+  return true;
+}
+
+Avida::Output::AsyncWriterPtr Avida::Output::Manager::AsyncOutputWriter() const
+{
+  return m_async_writer;
 }
 
 
@@ -156,6 +177,16 @@ Avida::WorldFacetID Avida::Output::Manager::UpdateAfter() const
 }
 
 
+void Avida::Output::Manager::PerformUpdate(Context& ctx, Update)
+{
+  // Surface errors from the asynchronous writer, since the code that produced the data has long since moved on
+  Apto::String message;
+  if (m_async_writer && m_async_writer->TakeError(message)) {
+    ctx.Driver().Feedback().Error("asynchronous output failed: %s", (const char*)message);
+  }
+}
+
+
 bool Avida::Output::Manager::RegisterSocket(const OutputID& output_id, SocketWeakRef socket_ref)
 {
   Apto::MutexAutoLock lock(m_mutex);
@@ -138,10 +138,8 @@ Avida::Systematics::GroupPtr Avida::Systematics::GenotypeArbiter::LegacyLoad(voi
 
 Avida::Systematics::GroupPtr Avida::Systematics::GenotypeArbiter::Group(GroupID g_id)
 {
-  for (int i = m_best; i >= 0; i--) {
-    Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
-    while (list_it.Next() != NULL) if ((*list_it.Get())->ID() == g_id) return *list_it.Get();
-  }
+  GenotypePtr active;
+  if (m_active_ids.Get(g_id, active)) return active;
   
   Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_historic.Begin());
   while (list_it.Next() != NULL) if ((*list_it.Get())->ID() == g_id) return *list_it.Get();
@@ -259,6 +257,30 @@ Avida::Data::PackagePtr Avida::Systematics::GenotypeArbiter::GetProvidedValue(co
 }
 
 
+int Avida::Systematics::GenotypeArbiter::ResolveProvidedSlot(const Data::DataID& data_id, Data::ValueType& type) const
+{
+  ProvidedData data_entry;
+  if (!m_provided_data.Get(data_id, data_entry) || data_entry.slot < 0) {
+    type = Data::VALUE_PACKAGE;
+    return -1;
+  }
+  type = m_typed_slots[data_entry.slot].type;
+  return data_entry.slot;
+}
+
+int Avida::Systematics::GenotypeArbiter::ProvidedIntValue(int slot) const
+{
+  assert(m_typed_slots[slot].type == Data::VALUE_INT);
+  return *m_typed_slots[slot].int_value;
+}
+
+double Avida::Systematics::GenotypeArbiter::ProvidedDoubleValue(int slot) const
+{
+  assert(m_typed_slots[slot].type == Data::VALUE_DOUBLE);
+  return *m_typed_slots[slot].double_value;
+}
+
+
 Apto::String Avida::Systematics::GenotypeArbiter::DescribeProvidedValue(const Data::DataID& data_id) const
 {
   ProvidedData data_entry;
@@ -278,9 +300,6 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
 {
   
   ConstInstructionSequencePtr seq;
-  seq.DynamicCastFrom(u->UnitGenome().Representation());
-  assert(seq);
-  int list_num = hashGenome(*seq);
   
   GenotypePtr found;
 
@@ -288,17 +307,8 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
   if (hints && hints->Get("id", gid_str)) {
     int gid = Apto::StrAs(gid_str);
     
-    // Search all lists attempting to locate the referenced genotype by ID
-    for (int i = 0; i < m_active_sz.GetSize() && !found; i++) {
-      Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_sz[i].Begin());
-      while (list_it.Next() != NULL) {
-        if ((*list_it.Get())->ID() == gid) {
-          found = *list_it.Get();
-          found->NotifyNewUnit(u);
-          break;
-        }
-      }
-    }
+    // Locate the referenced genotype by ID, first among the active genotypes
+    if (m_active_ids.Get(gid, found)) found->NotifyNewUnit(u);
     
     if (!found) {
       Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_historic.Begin());
@@ -309,6 +319,7 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
           assert(seq);
           
           m_active_hash[hashGenome(*seq)].Push(found);
+          m_active_ids.Set(gid, found);
           found->m_handle->Remove(); // Remove from historic list
           resizeActiveList(found->NumUnits());
           m_active_sz[found->NumUnits()].PushRear(found, &found->m_handle);
@@ -329,7 +340,12 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
   } 
   
   // No hints or unable to locate hinted genome, search for a matching genotype
+  int list_num = 0;
   if (!found) {
+    seq.DynamicCastFrom(u->UnitGenome().Representation());
+    assert(seq);
+    list_num = hashGenome(*seq);
+    
     Apto::List<GenotypePtr, Apto::SparseVector>::Iterator list_it(m_active_hash[list_num].Begin());
     while (list_it.Next() != NULL) {
       if ((*list_it.Get())->Matches(u)) {
@@ -344,6 +360,7 @@ Avida::Systematics::GenotypePtr Avida::Systematics::GenotypeArbiter::ClassifyNew
   if (!found) {
     found = GenotypePtr(new Genotype(thisPtr(), m_next_id++, u, m_cur_update, parents));
     m_active_hash[list_num].Push(found);
+    m_active_ids.Set(found->ID(), found);
     resizeActiveList(found->NumUnits());
     m_active_sz[found->NumUnits()].PushRear(found, &found->m_handle);
     m_tot_genotypes++;
@@ -408,6 +425,20 @@ template <class T> Avida::Data::PackagePtr Avida::Systematics::GenotypeArbiter::
   return Data::PackagePtr(new Data::Wrap<T>(val));
 }
 
+int Avida::Systematics::GenotypeArbiter::addTypedSlot(const int& val)
+{
+  TypedSlot slot = { Data::VALUE_INT, &val, NULL };
+  m_typed_slots.Push(slot);
+  return m_typed_slots.GetSize() - 1;
+}
+
+int Avida::Systematics::GenotypeArbiter::addTypedSlot(const double& val)
+{
+  TypedSlot slot = { Data::VALUE_DOUBLE, NULL, &val };
+  m_typed_slots.Push(slot);
+  return m_typed_slots.GetSize() - 1;
+}
+
 Avida::Data::ProviderPtr Avida::Systematics::GenotypeArbiter::activateProvider(World*) 
 {
   return thisPtr();
@@ -424,7 +455,7 @@ void Avida::Systematics::GenotypeArbiter::setupProvidedData(World* world)
 
   // Define PROVIDE macro to simplify instantiating new provided data
 #define PROVIDE(name, desc, type, val) { \
-  m_provided_data[Apto::String("systematics.") + Role() + "." + name] = ProvidedData(desc, Apto::BindFirst(type ## Stat, val));\
+  m_provided_data[Apto::String("systematics.") + Role() + "." + name] = ProvidedData(desc, Apto::BindFirst(type ## Stat, val), addTypedSlot(val));\
   mgr->Register(name, activate); \
 }
 
@@ -498,6 +529,7 @@ void Avida::Systematics::GenotypeArbiter::removeGenotype(GenotypePtr genotype)
     seq.DynamicCastFrom(genotype->GroupGenome().Representation());
     int list_num = hashGenome(*seq);
     m_active_hash[list_num].Remove(genotype);
+    m_active_ids.Remove(genotype->ID());
     genotype->Deactivate(m_cur_update);
     m_historic.Push(genotype, &genotype->m_handle);
   }
@@ -0,0 +1,455 @@
+/*
+ *  BenchmarkDriver.cc
+ *  avida-bench
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "BenchmarkDriver.h"
+
+#include "apto/core/FileSystem.h"
+#include "apto/platform.h"
+#include "apto/rng.h"
+#include "avida/core/Context.h"
+#include "avida/core/World.h"
+#include "avida/output/Manager.h"
+#include "avida/systematics/Unit.h"
+
+#include "avida/private/systematics/GenotypeArbiter.h"
+
+#include "cAliasSampler.h"
+#include "cAvidaContext.h"
+#include "cCPUTestInfo.h"
+#include "cEnvironment.h"
+#include "cHardwareManager.h"
+#include "cInstSet.h"
+#include "cOrderedWeightedIndex.h"
+#include "cOrganism.h"
+#include "cPhenotype.h"
+#include "cPopulation.h"
+#include "cReactionResult.h"
+#include "cResourceCount.h"
+#include "cStats.h"
+#include "cTaskContext.h"
+#include "cTaskState.h"
+#include "cTestCPU.h"
+#include "cWorld.h"
+
+#include <climits>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#if !APTO_PLATFORM(WINDOWS)
+# include <sys/time.h>
+#endif
+
+using namespace Avida;
+
+
+static const int BENCH_SEED = 1;
+
+
+namespace {
+  // Lightweight unit used to drive the genotype arbiter without the overhead of full organisms
+  class cBenchUnit : public Systematics::Unit
+  {
+  private:
+    Genome m_genome;
+    HashPropertyMap m_props;
+
+  public:
+    cBenchUnit(const Genome& genome) : m_genome(genome) { ; }
+    ~cBenchUnit() { ; }
+
+    Systematics::Source UnitSource() const { return Systematics::Source(Systematics::DIVISION, "benchmark", true); }
+    const Genome& UnitGenome() const { return m_genome; }
+    const PropertyMap& Properties() const { return m_props; }
+  };
+
+  Genome RandomGenome(cAvidaContext& ctx, const cInstSet& is, int length)
+  {
+    HashPropertyMap props;
+    cHardwareManager::SetupPropertyMap(props, (const char*)is.GetInstSetName());
+    Genome genome(is.GetHardwareType(), props, GeneticRepresentationPtr(new InstructionSequence(length)));
+    InstructionSequencePtr seq_p;
+    seq_p.DynamicCastFrom(genome.Representation());
+    InstructionSequence& seq = *seq_p;
+    for (int i = 0; i < length; i++) seq[i] = is.GetRandomInst(ctx);
+    return genome;
+  }
+};
+
+
+BenchmarkDriver::BenchmarkDriver(cWorld* world, World* new_world, const sSettings& settings)
+  : m_world(world), m_new_world(new_world), m_settings(settings), m_done(false)
+{
+  GlobalObjectManager::Register(this);
+  world->SetDriver(this);
+}
+
+BenchmarkDriver::~BenchmarkDriver()
+{
+  GlobalObjectManager::Unregister(this);
+  delete m_world;
+}
+
+
+void BenchmarkDriver::Run()
+{
+  cAvidaContext& ctx = m_world->GetDefaultContext();
+
+  benchTestCPU();
+  benchPopulation();
+  benchTestOutput();
+  benchClassification();
+  benchInstSampling();
+  benchResources(ctx);
+  benchSaveLoad(ctx);
+}
+
+
+void BenchmarkDriver::Abort(Avida::AbortCondition condition)
+{
+  exit(condition);
+}
+
+
+void BenchmarkDriver::WriteResults(std::ostream& out) const
+{
+  for (int i = 0; i < m_results.GetSize(); i++) {
+    const sResult& r = m_results[i];
+    const double rate = (r.seconds > 0.0) ? r.count / r.seconds : 0.0;
+    out << "{\"benchmark\": \"" << r.name << "\", \"units\": \"" << r.units << "\", \"count\": " << r.count
+        << ", \"seconds\": " << r.seconds << ", \"rate\": " << rate << "}" << std::endl;
+  }
+}
+
+
+double BenchmarkDriver::WallTime()
+{
+#if APTO_PLATFORM(WINDOWS)
+  return (double)clock() / (double)CLOCKS_PER_SEC;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (double)tv.tv_sec + (double)tv.tv_usec * 1.0e-6;
+#endif
+}
+
+
+void BenchmarkDriver::addResult(const Apto::String& name, const Apto::String& units, double count, double seconds)
+{
+  m_results.Push(sResult(name, units, count, seconds));
+}
+
+
+// Instructions/sec for every loaded instruction set (and so every hardware type in use), plus test CPU genomes/sec
+void BenchmarkDriver::benchTestCPU()
+{
+  cHardwareManager& hwm = m_world->GetHardwareManager();
+
+  for (int is_id = 0; is_id < hwm.GetNumInstSets(); is_id++) {
+    const cInstSet& is = hwm.GetInstSet(is_id);
+    Apto::RNG::AvidaRNG rng(BENCH_SEED);
+    cAvidaContext ctx(this, rng);
+
+    Apto::Array<Genome> genomes(m_settings.num_tests);
+    for (int i = 0; i < genomes.GetSize(); i++) genomes[i] = RandomGenome(ctx, is, m_settings.genome_length);
+
+    cTestCPU* testcpu = hwm.CreateTestCPU(ctx);
+    double cycles = 0.0;
+    const double start = WallTime();
+    for (int i = 0; i < genomes.GetSize(); i++) {
+      cCPUTestInfo test_info;
+      testcpu->TestGenome(ctx, test_info, genomes[i]);
+      const cPhenotype& phen = test_info.GetTestPhenotype();
+      cycles += (phen.GetNumDivides()) ? phen.GetLastCPUCyclesUsed() : phen.GetCPUCyclesUsed();
+    }
+    const double elapsed = WallTime() - start;
+    delete testcpu;
+
+    Apto::String suffix = Apto::FormatStr("[%s:%d]", (const char*)is.GetInstSetName(), is.GetHardwareType());
+    addResult(Apto::String("test_cpu.instructions") + suffix, "instructions", cycles, elapsed);
+    addResult(Apto::String("test_cpu.genomes") + suffix, "genomes", genomes.GetSize(), elapsed);
+  }
+}
+
+
+// Runs the configured experiment (events included) for a fixed number of updates, covering execution, the birth
+// chamber and offspring placement
+void BenchmarkDriver::benchPopulation()
+{
+  cPopulation& population = m_world->GetPopulation();
+  cStats& stats = m_world->GetStats();
+  cAvidaContext& ctx = m_world->GetDefaultContext();
+  Avida::Context new_ctx(this, &m_world->GetRandom());
+
+  const double point_mut_prob = m_world->GetConfig().POINT_MUT_PROB.Get() +
+                                m_world->GetConfig().POINT_INS_PROB.Get() +
+                                m_world->GetConfig().POINT_DEL_PROB.Get() +
+                                m_world->GetConfig().DIV_LGT_PROB.Get();
+  
+  void (cPopulation::*ActiveProcessStep)(cAvidaContext& ctx, double step_size, int cell_id) = &cPopulation::ProcessStep;
+  if (m_world->GetConfig().SPECULATIVE.Get() &&
+      m_world->GetConfig().THREAD_SLICING_METHOD.Get() != 1 && !m_world->GetConfig().IMPLICIT_REPRO_END.Get() && point_mut_prob == 0.0) {
+    ActiveProcessStep = &cPopulation::ProcessStepSpeculative;
+  }
+
+  const int start_births = stats.GetTotCreatures();
+  double steps = 0.0;
+  int updates = 0;
+  const double start = WallTime();
+  for (; updates < m_settings.num_updates && !m_done; updates++) {
+    m_world->GetEvents(ctx);
+    if (m_done) break;
+
+    stats.IncCurrentUpdate();
+    population.ProcessPreUpdate();
+    if (stats.GetUpdate() > 0) stats.ProcessUpdate();
+
+    const int UD_size = m_world->CalculateUpdateSize();
+    const double step_size = 1.0 / (double)UD_size;
+    for (int i = 0; i < UD_size; i++) {
+      if (population.GetNumOrganisms() == 0) break;
+      (population.*ActiveProcessStep)(ctx, step_size, population.ScheduleOrganism());
+      steps++;
+    }
+
+    population.ProcessPostUpdate(ctx);
+    m_world->ProcessPostUpdate(ctx);
+    m_new_world->PerformUpdate(new_ctx, stats.GetUpdate());
+  }
+  const double elapsed = WallTime() - start;
+
+  if (population.GetNumOrganisms() == 0) m_feedback.Warning("population is empty, check the event file injects organisms");
+
+  addResult("population.updates", "updates", updates, elapsed);
+  addResult("population.steps", "steps", steps, elapsed);
+  addResult("population.births", "births", stats.GetTotCreatures() - start_births, elapsed);
+}
+
+
+// cEnvironment::TestOutput, using the first living organism as the task context owner
+void BenchmarkDriver::benchTestOutput()
+{
+  cPopulation& population = m_world->GetPopulation();
+  if (population.GetLiveOrgList().GetSize() == 0) return;
+  cOrganism* org = population.GetLiveOrgList()[0];
+
+  Apto::RNG::AvidaRNG rng(BENCH_SEED);
+  cAvidaContext ctx(this, rng);
+
+  const cEnvironment& env = m_world->GetEnvironment();
+  const int num_resources = env.GetResourceLib().GetSize();
+  const int num_reactions = env.GetReactionLib().GetSize();
+  cReactionResult result(num_resources, env.GetNumTasks(), num_reactions);
+  Apto::Array<int> task_count(env.GetNumTasks());
+  Apto::Array<int> reaction_count(num_reactions);
+  Apto::Array<double> res_count(population.GetResources(ctx));
+  Apto::Array<double> rbins_count(num_resources);
+  task_count.SetAll(0);
+  rbins_count.SetAll(0.0);
+
+  Apto::Array<int> env_inputs;
+  env.SetupInputs(ctx, env_inputs);
+  tBuffer<int> inputs(env_inputs.GetSize());
+  for (int i = 0; i < env_inputs.GetSize(); i++) inputs.Add(env_inputs[i]);
+  tBuffer<int> outputs(1);
+  tList<tBuffer<int> > other_inputs;
+  tList<tBuffer<int> > other_outputs;
+  Apto::Array<int, Apto::Smart> ext_mem;
+  Apto::Map<void*, cTaskState*> task_states;
+
+  // Cycle through simple logic outputs of the inputs, so that tasks are both matched and missed
+  const int in_a = (env_inputs.GetSize() > 0) ? env_inputs[0] : 0;
+  const int in_b = (env_inputs.GetSize() > 1) ? env_inputs[1] : 0;
+  const int candidates[] = { ~in_a, ~(in_a & in_b), in_a & in_b, in_a | in_b, in_a ^ in_b, ctx.GetRandom().GetInt(INT_MAX) };
+  const int num_candidates = sizeof(candidates) / sizeof(int);
+
+  int matched = 0;
+  const double start = WallTime();
+  for (int i = 0; i < m_settings.num_iterations; i++) {
+    outputs.Clear();
+    outputs.Add(candidates[i % num_candidates]);
+    reaction_count.SetAll(0);
+
+    cTaskContext taskctx(org, inputs, outputs, other_inputs, other_outputs, ext_mem);
+    taskctx.SetTaskStates(&task_states);
+    if (env.TestOutput(ctx, result, taskctx, task_count, reaction_count, res_count, rbins_count)) matched++;
+  }
+  const double elapsed = WallTime() - start;
+
+  for (Apto::Map<void*, cTaskState*>::ValueIterator it = task_states.Values(); it.Next();) delete *it.Get();
+
+  addResult("environment.test_output", "outputs", m_settings.num_iterations, elapsed);
+}
+
+
+// GenotypeArbiter classification of a stream of related genomes, roughly half of which are new genotypes
+void BenchmarkDriver::benchClassification()
+{
+  Apto::RNG::AvidaRNG rng(BENCH_SEED);
+  cAvidaContext ctx(this, rng);
+  const cInstSet& is = m_world->GetHardwareManager().GetDefaultInstSet();
+
+  Apto::Array<Genome> bases(10);
+  for (int i = 0; i < bases.GetSize(); i++) bases[i] = RandomGenome(ctx, is, m_settings.genome_length);
+
+  Apto::Array<Systematics::UnitPtr> units(m_settings.num_iterations);
+  for (int i = 0; i < units.GetSize(); i++) {
+    Genome genome(bases[i % bases.GetSize()]);
+    if (ctx.GetRandom().P(0.5)) {
+      InstructionSequencePtr seq_p;
+      seq_p.DynamicCastFrom(genome.Representation());
+      (*seq_p)[ctx.GetRandom().GetInt(seq_p->GetSize())] = is.GetRandomInst(ctx);
+    }
+    units[i] = Systematics::UnitPtr(new cBenchUnit(genome));
+  }
+
+  Systematics::ArbiterPtr arbiter(new Systematics::GenotypeArbiter(m_new_world, m_world->GetConfig().THRESHOLD.Get()));
+  Apto::Array<Systematics::GroupPtr> groups(units.GetSize());
+
+  const double start = WallTime();
+  for (int i = 0; i < units.GetSize(); i++) groups[i] = arbiter->ClassifyNewUnit(units[i]);
+  const double elapsed = WallTime() - start;
+
+  // Release the units so that the arbiter can retire its genotypes
+  for (int i = 0; i < groups.GetSize(); i++) groups[i]->RemoveUnit();
+  groups.Resize(0);
+  Avida::Context new_ctx(this, &rng);
+  arbiter->PerformUpdate(new_ctx, 0);
+
+  addResult("systematics.genotype_classify", "units", units.GetSize(), elapsed);
+}
+
+
+// Random instruction draws weighted by redundancy, with the ordered weighted index that mutations used to search and
+// with the alias sampler that replaced it
+void BenchmarkDriver::benchInstSampling()
+{
+  const cInstSet& is = m_world->GetHardwareManager().GetDefaultInstSet();
+  const int num_samples = m_settings.num_iterations * 100;
+
+  cOrderedWeightedIndex ordered_index;
+  cAliasSampler sampler(is.GetSize());
+  for (int id = 0; id < is.GetSize(); id++) {
+    const int redundancy = is.GetRedundancy(Instruction(id));
+    if (redundancy > 0) ordered_index.SetWeight(id, redundancy);
+    sampler.SetWeight(id, redundancy);
+  }
+  sampler.Rebuild();
+
+  // The sums of the sampled IDs keep the loops from being optimized away, and should roughly agree
+  Apto::RNG::AvidaRNG ordered_rng(BENCH_SEED);
+  double ordered_sum = 0.0;
+  double start = WallTime();
+  for (int i = 0; i < num_samples; i++) {
+    ordered_sum += ordered_index.FindPosition(ordered_rng.GetDouble(ordered_index.GetTotalWeight()));
+  }
+  double elapsed = WallTime() - start;
+  addResult(Apto::FormatStr("inst_set.random_inst.ordered_index[%d]", is.GetSize()), "samples", num_samples, elapsed);
+
+  Apto::RNG::AvidaRNG alias_rng(BENCH_SEED);
+  double alias_sum = 0.0;
+  start = WallTime();
+  for (int i = 0; i < num_samples; i++) alias_sum += sampler.Sample(alias_rng);
+  elapsed = WallTime() - start;
+  addResult(Apto::FormatStr("inst_set.random_inst.alias[%d]", is.GetSize()), "samples", num_samples, elapsed);
+
+  m_feedback.Notify("mean sampled instruction: ordered index %g, alias %g", ordered_sum / num_samples, alias_sum / num_samples);
+}
+
+
+// cResourceCount::DoUpdates for whatever global, spatial and gradient resources the environment defines
+void BenchmarkDriver::benchResources(cAvidaContext& ctx)
+{
+  cResourceCount& resources = m_world->GetPopulation().GetResourceCount();
+  if (resources.GetSize() == 0) return;
+
+  int num_spatial = 0;
+  for (int i = 0; i < resources.GetSize(); i++) if (resources.IsSpatial(i)) num_spatial++;
+
+  const int first_update = m_world->GetStats().GetUpdate() + 1;
+  const double start = WallTime();
+  for (int i = 0; i < m_settings.num_iterations; i++) {
+    resources.SetSpatialUpdate(first_update + i);
+    resources.Update(1.0);
+    resources.UpdateResources(ctx);
+  }
+  const double elapsed = WallTime() - start;
+
+  addResult(Apto::FormatStr("resources.do_updates[%d:%d]", resources.GetSize(), num_spatial), "updates",
+            m_settings.num_iterations, elapsed);
+}
+
+
+// Structured population save and reload of the population left by the population benchmark
+void BenchmarkDriver::benchSaveLoad(cAvidaContext& ctx)
+{
+  cPopulation& population = m_world->GetPopulation();
+  const int num_orgs = population.GetNumOrganisms();
+  if (num_orgs == 0) return;
+
+  Apto::String path = Apto::FileSystem::PathAppend(Avida::Output::Manager::Of(m_new_world)->OutputPath(), "benchmark.spop");
+
+  double start = WallTime();
+  const bool saved = population.SavePopulation((const char*)path, true);
+  addResult("population.save", "organisms", num_orgs, WallTime() - start);
+  if (!saved) {
+    m_feedback.Warning("unable to save population to %s", (const char*)path);
+    return;
+  }
+
+  start = WallTime();
+  if (!population.LoadPopulation((const char*)path, ctx)) {
+    m_feedback.Warning("unable to load population from %s", (const char*)path);
+    return;
+  }
+  addResult("population.load", "organisms", population.GetNumOrganisms(), WallTime() - start);
+}
+
+
+void BenchmarkDriver::StdIOFeedback::Error(const char* fmt, ...)
+{
+  fprintf(stderr, "error: ");
+  va_list args;
+  va_start(args, fmt);
+  vfprintf(stderr, fmt, args);
+  va_end(args);
+  fprintf(stderr, "\n");
+}
+
+void BenchmarkDriver::StdIOFeedback::Warning(const char* fmt, ...)
+{
+  fprintf(stderr, "warning: ");
+  va_list args;
+  va_start(args, fmt);
+  vfprintf(stderr, fmt, args);
+  va_end(args);
+  fprintf(stderr, "\n");
+}
+
+void BenchmarkDriver::StdIOFeedback::Notify(const char* fmt, ...)
+{
+  va_list args;
+  va_start(args, fmt);
+  vfprintf(stderr, fmt, args);
+  va_end(args);
+  fprintf(stderr, "\n");
+}
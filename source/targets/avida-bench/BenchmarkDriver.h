@@ -0,0 +1,114 @@
+/*
+ *  BenchmarkDriver.h
+ *  avida-bench
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BenchmarkDriver_h
+#define BenchmarkDriver_h
+
+#include "avida/core/Feedback.h"
+#include "avida/core/Types.h"
+#include "avida/core/WorldDriver.h"
+
+#include <iostream>
+
+class cAvidaContext;
+class cWorld;
+
+
+// BenchmarkDriver - runs a fixed set of timed workloads against a configured world
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Every benchmark draws from its own fixed seed, so the work performed is identical from run to run and only the
+//  elapsed time varies.  Results are written one JSON object per line.
+
+class BenchmarkDriver : public Avida::WorldDriver
+{
+public:
+  struct sSettings
+  {
+    int num_updates;       // population updates to run for the birth/execution benchmark
+    int num_tests;         // genomes per instruction set for the test CPU benchmark
+    int genome_length;     // length of the random genomes used by the test CPU and classification benchmarks
+    int num_iterations;    // iterations for the resource, output and classification benchmarks
+
+    sSettings() : num_updates(200), num_tests(200), genome_length(100), num_iterations(20000) { ; }
+  };
+
+private:
+  struct sResult
+  {
+    Apto::String name;
+    Apto::String units;
+    double count;
+    double seconds;
+
+    sResult() : count(0.0), seconds(0.0) { ; }
+    sResult(const Apto::String& in_name, const Apto::String& in_units, double in_count, double in_seconds)
+      : name(in_name), units(in_units), count(in_count), seconds(in_seconds) { ; }
+  };
+
+  class StdIOFeedback : public Avida::Feedback
+  {
+    void Error(const char* fmt, ...);
+    void Warning(const char* fmt, ...);
+    void Notify(const char* fmt, ...);
+  } m_feedback;
+
+  cWorld* m_world;
+  Avida::World* m_new_world;
+  sSettings m_settings;
+  bool m_done;
+
+  Apto::Array<sResult> m_results;
+
+public:
+  BenchmarkDriver(cWorld* world, Avida::World* new_world, const sSettings& settings);
+  ~BenchmarkDriver();
+
+  // Actions
+  void Run();
+
+  void Finish() { m_done = true; }
+  void Pause() { return; }
+  void Abort(Avida::AbortCondition condition);
+
+  // Facilities
+  Avida::Feedback& Feedback() { return m_feedback; }
+
+  // Callback
+  void RegisterCallback(Avida::DriverCallback callback) { (void)callback; }
+
+  void WriteResults(std::ostream& out) const;
+
+  static double WallTime();
+
+private:
+  void benchTestCPU();
+  void benchPopulation();
+  void benchTestOutput();
+  void benchClassification();
+  void benchInstSampling();
+  void benchResources(cAvidaContext& ctx);
+  void benchSaveLoad(cAvidaContext& ctx);
+
+  void addResult(const Apto::String& name, const Apto::String& units, double count, double seconds);
+};
+
+#endif
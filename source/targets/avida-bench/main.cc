@@ -0,0 +1,100 @@
+/*
+ *  main.cc
+ *  avida-bench
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "apto/core/FileSystem.h"
+#include "avida/Avida.h"
+#include "avida/core/World.h"
+#include "avida/util/CmdLine.h"
+
+#include "cAvidaConfig.h"
+#include "cUserFeedback.h"
+#include "cWorld.h"
+
+#include "BenchmarkDriver.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+
+
+// Benchmark specific options are consumed here, everything else is handed to the standard Avida argument processing:
+//   -bench-updates <n>     population updates to run (default 200)
+//   -bench-tests <n>       test CPU genomes per instruction set (default 200)
+//   -bench-iterations <n>  iterations of the resource, output and classification benchmarks (default 20000)
+//   -bench-output <file>   write results to <file> rather than standard output
+int main(int argc, char * argv[])
+{
+  Avida::Initialize();
+
+  BenchmarkDriver::sSettings settings;
+  cString output_filename;
+
+  Apto::Array<char*> avida_args;
+  avida_args.Push(argv[0]);
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 < argc && strcmp(argv[i], "-bench-updates") == 0) settings.num_updates = atoi(argv[++i]);
+    else if (i + 1 < argc && strcmp(argv[i], "-bench-tests") == 0) settings.num_tests = atoi(argv[++i]);
+    else if (i + 1 < argc && strcmp(argv[i], "-bench-iterations") == 0) settings.num_iterations = atoi(argv[++i]);
+    else if (i + 1 < argc && strcmp(argv[i], "-bench-output") == 0) output_filename = argv[++i];
+    else avida_args.Push(argv[i]);
+  }
+
+  // Initialize the configuration data...
+  Apto::Map<Apto::String, Apto::String> defs;
+  cAvidaConfig* cfg = new cAvidaConfig();
+  Avida::Util::ProcessCmdLineArgs(avida_args.GetSize(), &avida_args[0], cfg, defs);
+
+  // Results are only comparable between runs when the work done is identical
+  if (cfg->RANDOM_SEED.Get() == 0) cfg->RANDOM_SEED.Set(1);
+  cfg->VERBOSITY.Set(VERBOSE_SILENT);
+
+  cUserFeedback feedback;
+  Avida::World* new_world = new Avida::World();
+  cWorld* world = cWorld::Initialize(cfg, cString(Apto::FileSystem::GetCWD()), new_world, &feedback, &defs);
+
+  for (int i = 0; i < feedback.GetNumMessages(); i++) {
+    switch (feedback.GetMessageType(i)) {
+      case cUserFeedback::UF_ERROR:    cerr << "error: "; break;
+      case cUserFeedback::UF_WARNING:  cerr << "warning: "; break;
+      default: break;
+    };
+    cerr << feedback.GetMessage(i) << endl;
+  }
+
+  if (!world) return -1;
+
+  BenchmarkDriver* driver = new BenchmarkDriver(world, new_world, settings);
+  driver->Run();
+
+  if (output_filename.GetSize()) {
+    ofstream out((const char*)output_filename);
+    driver->WriteResults(out);
+  } else {
+    driver->WriteResults(cout);
+  }
+
+  delete driver;
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+/*
+ *  main.cc
+ *  avida-columnar
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "avida/data/ColumnarRecorder.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+
+
+// Converts a binary columnar data file (see RecordColumnarData) into the text .dat layout:
+//   avida-columnar [-list] <input file> [output file]
+//   -list   print the recorded columns and their types, rather than converting
+int main(int argc, char * argv[])
+{
+  bool list_only = false;
+  int argi = 1;
+  if (argi < argc && strcmp(argv[argi], "-list") == 0) {
+    list_only = true;
+    argi++;
+  }
+
+  if (argi >= argc) {
+    cerr << "usage: " << argv[0] << " [-list] <input file> [output file]" << endl;
+    return 1;
+  }
+
+  Avida::Data::ColumnarReader reader;
+  if (!reader.Open(argv[argi])) {
+    cerr << "error: " << (const char*)reader.Error() << endl;
+    return 1;
+  }
+
+  if (list_only) {
+    static const char* type_names[] = { "int", "double", "string", "int64", "uint64" };
+    for (int i = 0; i < reader.NumColumns(); i++) {
+      const Avida::Data::ColumnType type = reader.ColumnTypeOf(i);
+      cout << (const char*)reader.ColumnDataID(i) << " " << ((type == Avida::Data::COLUMN_UNTYPED) ? "untyped" : type_names[type]) << endl;
+    }
+    return 0;
+  }
+
+  bool success;
+  if (argi + 1 < argc) {
+    ofstream out(argv[argi + 1]);
+    if (!out.good()) {
+      cerr << "error: unable to open '" << argv[argi + 1] << "' for writing" << endl;
+      return 1;
+    }
+    success = reader.ExportText(out);
+  } else {
+    success = reader.ExportText(cout);
+  }
+
+  if (!success) {
+    if (reader.Error().GetSize()) cerr << "error: " << (const char*)reader.Error() << endl;
+    else cerr << "error: unable to write output" << endl;
+    return 1;
+  }
+
+  return 0;
+}
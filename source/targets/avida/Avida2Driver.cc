@@ -26,6 +26,7 @@
 
 #include "avida/core/Context.h"
 #include "avida/core/World.h"
+#include "avida/output/Manager.h"
 #include "avida/systematics/Group.h"
 
 #include "cAnalyze.h"
@@ -164,6 +165,8 @@ void Avida2Driver::Run()
 
 void Avida2Driver::Abort(Avida::AbortCondition condition)
 {
+  // Data files may still be buffered for asynchronous writing, get them to disk before exiting
+  Avida::Output::Manager::Of(m_new_world)->FlushAll();
   exit(condition);
 }
 
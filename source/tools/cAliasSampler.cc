@@ -0,0 +1,103 @@
+/*
+ *  cAliasSampler.cc
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cAliasSampler.h"
+
+
+cAliasSampler::cAliasSampler(int size)
+  : m_weights(size), m_total_weight(0.0), m_stale(true)
+{
+  m_weights.SetAll(0.0);
+}
+
+
+void cAliasSampler::Resize(int size)
+{
+  const int old_size = m_weights.GetSize();
+  m_weights.Resize(size);
+  for (int i = old_size; i < size; i++) m_weights[i] = 0.0;
+  m_stale = true;
+}
+
+
+void cAliasSampler::SetWeight(int id, double weight)
+{
+  assert(weight >= 0.0);
+  m_total_weight += weight - m_weights[id];
+  m_weights[id] = weight;
+  m_stale = true;
+}
+
+
+void cAliasSampler::Rebuild()
+{
+  const int size = m_weights.GetSize();
+  m_prob.Resize(size);
+  m_alias.Resize(size);
+  m_stale = false;
+
+  m_total_weight = 0.0;
+  for (int i = 0; i < size; i++) m_total_weight += m_weights[i];
+  if (m_total_weight <= 0.0) return;
+
+  // Scale the weights so that they average 1.0, then split them into under and over full columns (used as stacks)
+  Apto::Array<double> scaled(size);
+  Apto::Array<int> small(size);
+  Apto::Array<int> large(size);
+  int num_small = 0;
+  int num_large = 0;
+  for (int i = 0; i < size; i++) {
+    scaled[i] = m_weights[i] * size / m_total_weight;
+    if (scaled[i] < 1.0) small[num_small++] = i;
+    else large[num_large++] = i;
+  }
+
+  // Fill each under full column with the excess of an over full one
+  int last_large = -1;
+  while (num_small && num_large) {
+    const int s = small[--num_small];
+    const int l = large[--num_large];
+    m_prob[s] = scaled[s];
+    m_alias[s] = l;
+    scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+    if (scaled[l] < 1.0) small[num_small++] = l;
+    else large[num_large++] = l;
+    last_large = l;
+  }
+
+  // Whatever remains is full, up to rounding error.  Zero weight columns must never be kept, though.
+  while (num_large) {
+    const int l = large[--num_large];
+    m_prob[l] = 1.0;
+    m_alias[l] = l;
+    last_large = l;
+  }
+  while (num_small) {
+    const int s = small[--num_small];
+    if (m_weights[s] > 0.0 || last_large < 0) {
+      m_prob[s] = 1.0;
+      m_alias[s] = s;
+    } else {
+      m_prob[s] = 0.0;
+      m_alias[s] = last_large;
+    }
+  }
+}
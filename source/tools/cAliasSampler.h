@@ -0,0 +1,76 @@
+/*
+ *  cAliasSampler.h
+ *  Avida
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef cAliasSampler_h
+#define cAliasSampler_h
+
+#include "avida/core/Types.h"
+
+#include <cassert>
+
+
+// cAliasSampler - Constant time sampling of indices in proportion to their weights (Vose's alias method)
+// --------------------------------------------------------------------------------------------------------------
+//
+//  Each sample costs a single random draw and one table lookup.  Changing a weight marks the table stale, and the next
+//  sample rebuilds it in linear time, so the sampler suits weight sets that rarely change.  Samplers shared between
+//  threads must be rebuilt explicitly with Rebuild() after their weights change.
+
+class cAliasSampler
+{
+private:
+  Apto::Array<double> m_weights;
+  double m_total_weight;
+  bool m_stale;
+
+  Apto::Array<double> m_prob;     // chance of keeping a column's own index, rather than taking its alias
+  Apto::Array<int> m_alias;
+
+
+public:
+  cAliasSampler(int size = 0);
+
+  void Resize(int size);
+  void SetWeight(int id, double weight);
+  void Rebuild();
+
+  int GetSize() const { return m_weights.GetSize(); }
+  double GetWeight(int id) const { return m_weights[id]; }
+  double GetTotalWeight() const { return m_total_weight; }
+
+  inline int Sample(Apto::Random& rng);
+};
+
+
+inline int cAliasSampler::Sample(Apto::Random& rng)
+{
+  if (m_stale) Rebuild();
+  assert(m_total_weight > 0.0);
+
+  // The integer part of the draw selects the column, the fractional part decides between the column and its alias
+  const int size = m_prob.GetSize();
+  const double draw = rng.GetDouble(size);
+  int column = (int)draw;
+  if (column >= size) column = size - 1;
+  return ((draw - column) < m_prob[column]) ? column : m_alias[column];
+}
+
+#endif
@@ -315,9 +315,11 @@ void Avida::Viewer::Driver::Run()
   m_mutex.Lock();
   while (!m_done && m_pause_state == DRIVER_PAUSED) {
     m_paused = true;
+    if (m_map) m_map->SetPopulationIdle(true);
     m_pause_cv.Wait(m_mutex);
   }
   m_paused = false;
+  if (m_map) m_map->SetPopulationIdle(false);
   m_mutex.Unlock();
   
   if (m_done) return;
@@ -452,9 +454,11 @@ void Avida::Viewer::Driver::Run()
       m_mutex.Lock();
       while (!m_done && m_pause_state != DRIVER_UNPAUSED) {
         m_paused = true;
+        if (m_map) m_map->SetPopulationIdle(true);
         m_pause_cv.Wait(m_mutex);
       }
       m_paused = false;
+      if (m_map) m_map->SetPopulationIdle(false);
     }
     m_mutex.Unlock();
   } catch (Avida::AbortCondition condition) {
@@ -499,7 +503,10 @@ void Avida::Viewer::Driver::AttachListener(Listener* listener)
   m_mutex.Lock();
   m_listeners.Insert(listener);
   
-  if (listener->WantsMap() && !m_map) m_map = new Map(m_world);
+  if (listener->WantsMap() && !m_map) {
+    m_map = new Map(m_world);
+    if (m_paused) m_map->SetPopulationIdle(true);
+  }
   m_mutex.Unlock();
 }
 
@@ -41,7 +41,53 @@ Avida::Viewer::MapMode::~MapMode() { ; }
 Avida::Viewer::DiscreteScale::~DiscreteScale() { ; }
 
 
-class DoublePropMapMode : public Avida::Viewer::MapMode, public Avida::Viewer::DiscreteScale
+// BufferedMapMode - Storage for the front and back buffers of a map mode
+// --------------------------------------------------------------------------------------------------------------
+
+class BufferedMapMode : public Avida::Viewer::MapMode, public Avida::Viewer::DiscreteScale
+{
+protected:
+  struct Buffer
+  {
+    Apto::Array<int> grid;
+    Apto::Array<int> counts;
+    Apto::Array<DiscreteScale::Entry> labels;
+  };
+  
+private:
+  Buffer m_buffers[2];
+  int m_front;
+  
+public:
+  BufferedMapMode(int num_cells, int num_counts, int num_labels) : m_front(0)
+  {
+    for (int i = 0; i < 2; i++) {
+      m_buffers[i].grid.Resize(num_cells);
+      m_buffers[i].grid.SetAll(Avida::Viewer::MAP_RESERVED_COLOR_BLACK);
+      m_buffers[i].counts.Resize(num_counts);
+      m_buffers[i].counts.SetAll(0);
+      m_buffers[i].labels.Resize(num_labels);
+    }
+  }
+  
+  // MapMode Interface
+  const Apto::Array<int>& GetGridValues() const { return m_buffers[m_front].grid; }
+  const Apto::Array<int>& GetValueCounts() const { return m_buffers[m_front].counts; }
+  const DiscreteScale& GetScale() const { return *this; }
+  void SwapBuffers() { m_front = 1 - m_front; }
+  
+  // DiscreteScale Interface
+  int GetScaleRange() const { return m_buffers[m_front].counts.GetSize() - Avida::Viewer::MAP_RESERVED_COLORS; }
+  int GetNumLabeledEntries() const { return m_buffers[m_front].labels.GetSize(); }
+  DiscreteScale::Entry GetEntry(int index) const { return m_buffers[m_front].labels[index]; }
+  
+protected:
+  inline Buffer& backBuffer() { return m_buffers[1 - m_front]; }
+};
+
+
+
+class DoublePropMapMode : public BufferedMapMode
 {
 private:
   static const int SCALE_MAX = 201;
@@ -51,11 +97,11 @@ private:
   static const double MAX_RESCALE_FACTOR;
 private:
   const Apto::String m_prop_id;
+  const int m_prop_handle;
   Apto::String m_prop_desc;
   Apto::String m_prop_desc_rescale;
   
-  Apto::Array<int> m_color_grid;
-  Apto::Array<int> m_color_count;
+  Apto::Array<double> m_values;
   Apto::Array<DiscreteScale::Entry> m_scale_labels;
   
   double m_cur_min;
@@ -65,14 +111,15 @@ private:
   double m_rescale_rate_min;
   double m_rescale_rate_max;
   
+  bool m_front_rescaling;
+  
 public:
   DoublePropMapMode(cWorld* world, const Apto::String& prop_id, const Apto::String& prop_desc)
-  : m_prop_id(prop_id), m_prop_desc(prop_desc), m_color_count(SCALE_MAX + Avida::Viewer::MAP_RESERVED_COLORS), m_scale_labels(SCALE_LABELS)
+  : BufferedMapMode(world->GetPopulation().GetSize(), SCALE_MAX + Avida::Viewer::MAP_RESERVED_COLORS, SCALE_LABELS)
+  , m_prop_id(prop_id), m_prop_handle(cOrganism::PropertyHandle(prop_id)), m_prop_desc(prop_desc), m_scale_labels(SCALE_LABELS)
   , m_cur_min(0.0), m_cur_max(0.0), m_target_min(0.0), m_target_max(0.0), m_rescale_rate_min(0.0), m_rescale_rate_max(0.0)
+  , m_front_rescaling(false)
   {
-    m_color_grid.Resize(world->GetPopulation().GetSize());
-    m_color_grid.SetAll(-4);
-    
     m_prop_desc_rescale = m_prop_desc + " (rescaling)";
   }
   ~DoublePropMapMode() { ; }
@@ -82,11 +129,7 @@ public:
   
   // MapMode Interface
   const Apto::String& GetName() const { return m_prop_desc; }
-  const Apto::Array<int>& GetGridValues() const { return m_color_grid; }
-  const Apto::Array<int>& GetValueCounts() const { return m_color_count; }
-  
-  const DiscreteScale& GetScale() const { return *this; }
-  const Apto::String& GetScaleLabel() const;
+  const Apto::String& GetScaleLabel() const { return (m_front_rescaling) ? m_prop_desc_rescale : m_prop_desc; }
   
   int GetSupportedTypes() const { return Avida::Viewer::MAP_GRID_VIEW_COLOR; }
   
@@ -94,12 +137,10 @@ public:
   Apto::String GetProperty(const Apto::String&) const { return ""; }
   
   void Update(cPopulation& pop);
+  void SwapBuffers() { BufferedMapMode::SwapBuffers(); m_front_rescaling = (m_rescale_rate_max != 0.0); }
   
-  
-  // DiscreteScale Interface
-  int GetScaleRange() const { return m_color_count.GetSize() - Avida::Viewer::MAP_RESERVED_COLORS; }
-  int GetNumLabeledEntries() const { return m_scale_labels.GetSize(); }
-  DiscreteScale::Entry GetEntry(int index) const { return m_scale_labels[index]; }
+private:
+  void updateScaleLabels();
 };
 
 const double DoublePropMapMode::RESCALE_TOLERANCE = 0.1;
@@ -107,20 +148,31 @@ const double DoublePropMapMode::MAX_RESCALE_FACTOR = 0.03;
 
 void DoublePropMapMode::Update(cPopulation& pop)
 {
-  m_color_grid.Resize(pop.GetSize());
+  Buffer& buf = backBuffer();
+  buf.grid.Resize(pop.GetSize());
+  m_values.Resize(pop.GetSize());
   
   // Keep track of how many times each color was assigned.
-  m_color_count.SetAll(0);
+  buf.counts.SetAll(0);
   
-  // Determine the max and min in the population.
+  // Collect the property values of all organisms, marking the cells that get reserved colors, and determine the
+  // max and min in the population.
   double max_fit = 0.0;
   double min_fit = 0.0;
   
   for (int i = 0; i < pop.GetSize(); i++) {
     cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) continue;
-    double fit = org->Properties().Get(m_prop_id);
-    if (fit == 0.0) continue;
+    if (org == NULL) {
+      buf.grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_BLACK;
+      continue;
+    }
+    const double fit = (m_prop_handle >= 0) ? org->PropertyAsDouble(m_prop_handle) : (double)org->Properties().Get(m_prop_id);
+    m_values[i] = fit;
+    if (fit == 0.0) {
+      buf.grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_DARK_GRAY;
+      continue;
+    }
+    buf.grid[i] = 0;
     if (fit > max_fit) max_fit = fit;
     if (fit < min_fit) min_fit = fit;
   }
@@ -132,12 +184,7 @@ void DoublePropMapMode::Update(cPopulation& pop)
     m_rescale_rate_min = 0.0;
     m_rescale_rate_max = 0.0;
     
-    // Update scale labels
-    for (int i = 0; i < m_scale_labels.GetSize(); i++) {
-      m_scale_labels[i].index = (SCALE_MAX / (m_scale_labels.GetSize() - 1)) * i;
-      m_scale_labels[i].label =
-      static_cast<const char*>(cStringUtil::Stringf("%2.2f", ((m_cur_max - m_cur_min) / (m_scale_labels.GetSize() - 1)) * i));
-    }
+    updateScaleLabels();
   } else {
     if (max_fit < (1.0 - RESCALE_TOLERANCE) * m_target_max || m_target_max < max_fit) {
       m_target_max = max_fit * (1.0 + RESCALE_TOLERANCE);
@@ -157,50 +204,39 @@ void DoublePropMapMode::Update(cPopulation& pop)
         m_rescale_rate_max = 0.0;
       }
       
-      // Update scale labels
-      for (int i = 0; i < m_scale_labels.GetSize(); i++) {
-        m_scale_labels[i].index = (SCALE_MAX / (m_scale_labels.GetSize() - 1)) * i;
-        m_scale_labels[i].label =
-        static_cast<const char*>(cStringUtil::Stringf("%2.2f", ((m_cur_max - m_cur_min) / (m_scale_labels.GetSize() - 1)) * i));
-      }
+      updateScaleLabels();
     }
   }
+  buf.labels = m_scale_labels;
   
-  // Now fill out the color grid.
+  // Now fill out the color grid from the collected values.
   for (int i = 0; i < pop.GetSize(); i++) {
-    cOrganism* org = pop.GetCell(i).GetOrganism();
-    if (org == NULL) {
-      m_color_grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_BLACK;
-      m_color_count[Avida::Viewer::MAP_RESERVED_COLORS - Avida::Viewer::MAP_RESERVED_COLOR_BLACK]++;
-      continue;
-    }
-    
-    double fit = org->Properties().Get(m_prop_id);
-    if (fit == 0.0) {
-      m_color_grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_DARK_GRAY;
-      m_color_count[Avida::Viewer::MAP_RESERVED_COLORS - Avida::Viewer::MAP_RESERVED_COLOR_DARK_GRAY]++;
+    if (buf.grid[i] < 0) {
+      buf.counts[Avida::Viewer::MAP_RESERVED_COLORS - buf.grid[i]]++;
       continue;
     }
     
     //    fit = log2(fit);
     
-    fit = (fit - m_cur_min) / (m_cur_max - m_cur_min);
+    const double fit = (m_values[i] - m_cur_min) / (m_cur_max - m_cur_min);
     if (fit > 1.0) {
-      m_color_grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_WHITE;
-      m_color_count[Avida::Viewer::MAP_RESERVED_COLORS - Avida::Viewer::MAP_RESERVED_COLOR_WHITE]++;
+      buf.grid[i] = Avida::Viewer::MAP_RESERVED_COLOR_WHITE;
+      buf.counts[Avida::Viewer::MAP_RESERVED_COLORS - Avida::Viewer::MAP_RESERVED_COLOR_WHITE]++;
     } else {
       int color = fit * static_cast<double>(SCALE_MAX - 1);
-      m_color_grid[i] = color;
-      m_color_count[color + Avida::Viewer::MAP_RESERVED_COLORS]++;
+      buf.grid[i] = color;
+      buf.counts[color + Avida::Viewer::MAP_RESERVED_COLORS]++;
     }
   }
 }
 
-const Apto::String& DoublePropMapMode::GetScaleLabel() const
-{  
-  if (m_rescale_rate_max != 0) return m_prop_desc_rescale;
-  
-  return m_prop_desc;
+void DoublePropMapMode::updateScaleLabels()
+{
+  for (int i = 0; i < m_scale_labels.GetSize(); i++) {
+    m_scale_labels[i].index = (SCALE_MAX / (m_scale_labels.GetSize() - 1)) * i;
+    m_scale_labels[i].label =
+    static_cast<const char*>(cStringUtil::Stringf("%2.2f", ((m_cur_max - m_cur_min) / (m_scale_labels.GetSize() - 1)) * i));
+  }
 }
 
 
@@ -208,7 +244,7 @@ const Apto::String& DoublePropMapMode::GetScaleLabel() const
 
 
 
-class ClassificationMapMode : public Avida::Viewer::MapMode, public Avida::Viewer::DiscreteScale
+class ClassificationMapMode : public BufferedMapMode
 {
 private:
   static const int NUM_COLORS = 10;
@@ -217,9 +253,10 @@ private:
   const Apto::String m_role_desc;
   
   Avida::Viewer::ClassificationInfo* m_info;
-  Apto::Array<int> m_color_grid;
-  Apto::Array<int> m_color_count;
-  Apto::Array<DiscreteScale::Entry> m_scale_labels;
+  
+  // Group of the occupant of each cell, looked up again only when the occupant changes
+  Apto::Array<int> m_cell_org_ids;
+  Apto::Array<Systematics::GroupPtr> m_cell_groups;
   
 public:
   ClassificationMapMode(cWorld* world, const Apto::String& role_id, const Apto::String& role_desc);
@@ -229,10 +266,6 @@ public:
   
   // MapMode Interface
   const Apto::String& GetName() const { return m_role_desc; }
-  const Apto::Array<int>& GetGridValues() const { return m_color_grid; }
-  const Apto::Array<int>& GetValueCounts() const { return m_color_count; }
-  
-  const DiscreteScale& GetScale() const { return *this; }
   const Apto::String& GetScaleLabel() const { return m_role_desc; }
   
   int GetSupportedTypes() const { return Avida::Viewer::MAP_GRID_VIEW_COLOR; }
@@ -244,73 +277,93 @@ public:
   
   
   // DiscreteScale Interface
-  int GetScaleRange() const { return m_color_count.GetSize() - Avida::Viewer::MAP_RESERVED_COLORS; }
-  int GetNumLabeledEntries() const { return m_scale_labels.GetSize(); }
-  DiscreteScale::Entry GetEntry(int index) const { return m_scale_labels[index]; }
   bool IsCategorical() const { return true; }
 };
 
 ClassificationMapMode::ClassificationMapMode(cWorld* world, const Apto::String& role_id, const Apto::String& role_desc)
-: m_role_id(role_id), m_role_desc(role_desc)
+: BufferedMapMode(world->GetPopulation().GetSize(), NUM_COLORS + Avida::Viewer::MAP_RESERVED_COLORS,
+                  NUM_COLORS + Avida::Viewer::MAP_RESERVED_COLORS)
+, m_role_id(role_id), m_role_desc(role_desc)
 , m_info(new Avida::Viewer::ClassificationInfo(world->GetNewWorld(), role_id, NUM_COLORS, NUM_COLORS))
-, m_color_count(NUM_COLORS + Avida::Viewer::MAP_RESERVED_COLORS)
-, m_scale_labels(NUM_COLORS + Avida::Viewer::MAP_RESERVED_COLORS)
 {
-  m_scale_labels[0].index = -4;
-  m_scale_labels[0].label = "Unoccupied";
-  m_scale_labels[1].index = -3;
-  m_scale_labels[1].label = "-";
-  m_scale_labels[2].index = -2;
-  m_scale_labels[2].label = "-";
-  m_scale_labels[3].index = -1;
-  m_scale_labels[3].label = "Unassigned";
-  for (int i = 4; i < m_scale_labels.GetSize(); i++) m_scale_labels[i].index = i - 4;
-  m_color_grid.Resize(world->GetPopulation().GetSize());
-  m_color_grid.SetAll(-4);
+  for (int b = 0; b < 2; b++) {
+    Apto::Array<DiscreteScale::Entry>& labels = backBuffer().labels;
+    for (int i = 0; i < labels.GetSize(); i++) {
+      labels[i].index = i - 4;
+      labels[i].label = "-";
+    }
+    labels[0].label = "Unoccupied";
+    labels[3].label = "Unassigned";
+    SwapBuffers();
+  }
 }
 
 void ClassificationMapMode::Update(cPopulation& pop)
 {
   m_info->Update();
-  m_color_grid.Resize(pop.GetSize());
-  m_color_count.SetAll(0);            // reset all color counts
+  
+  Buffer& buf = backBuffer();
+  buf.grid.Resize(pop.GetSize());
+  buf.counts.SetAll(0);            // reset all color counts
+  
+  if (m_cell_org_ids.GetSize() != pop.GetSize()) {
+    m_cell_org_ids.Resize(pop.GetSize());
+    m_cell_org_ids.SetAll(-1);
+    m_cell_groups.Resize(pop.GetSize());
+  }
+  
   for (int i = 0; i < pop.GetSize(); i++) {
     cOrganism* org = pop.GetCell(i).GetOrganism();
     if (org == NULL) {
-      m_color_grid[i] = -4;
-      m_color_count[0]++;
-    } else {
-      Systematics::GroupPtr bg = org->SystematicsGroup(m_role_id);
-      if (bg) {
-        Avida::Viewer::ClassificationInfo::MapColorPtr mapcolor = bg->GetData<Avida::Viewer::ClassificationInfo::MapColor>();
-        if (mapcolor) {
-          m_color_grid[i] = mapcolor->color;
-          m_color_count[mapcolor->color + 4]++;
-          m_scale_labels[mapcolor->color + 4].label = bg->Properties().Get("name").StringValue();
-          continue;
+      m_cell_org_ids[i] = -1;
+      m_cell_groups[i] = Systematics::GroupPtr();
+      buf.grid[i] = -4;
+      buf.counts[0]++;
+      continue;
+    }
+    
+    if (m_cell_org_ids[i] != org->GetID()) {
+      m_cell_org_ids[i] = org->GetID();
+      m_cell_groups[i] = org->SystematicsGroup(m_role_id);
+    }
+    
+    const Systematics::GroupPtr& bg = m_cell_groups[i];
+    if (bg) {
+      Avida::Viewer::ClassificationInfo::MapColorPtr mapcolor = bg->GetData<Avida::Viewer::ClassificationInfo::MapColor>();
+      if (mapcolor) {
+        buf.grid[i] = mapcolor->color;
+        if (buf.counts[mapcolor->color + 4]++ == 0) {
+          buf.labels[mapcolor->color + 4].label = bg->Properties().Get("name").StringValue();
         }
+        continue;
       }
-      m_color_grid[i] = -1;
-      m_color_count[3]++;
     }
+    buf.grid[i] = -1;
+    buf.counts[3]++;
   }
-  for (int i = 0; i < m_color_count.GetSize(); i++) if (m_color_count[i] == 0) m_scale_labels[i].label = "-";
+  
+  buf.labels[0].label = "Unoccupied";
+  buf.labels[3].label = "Unassigned";
+  for (int i = 0; i < buf.counts.GetSize(); i++) if (buf.counts[i] == 0) buf.labels[i].label = "-";
 }
 
 
 
 
-class EnvActionMapMode : public Avida::Viewer::MapMode, public Avida::Viewer::DiscreteScale
+class EnvActionMapMode : public BufferedMapMode
 {
 private:
   cWorld* m_world;
-  Apto::Array<int> m_action_grid;
+  
+  // Actions performed by the genotype of the occupant of each cell, tested again only when the occupant changes
+  Apto::Array<int> m_cell_org_ids;
   Apto::Array<Apto::Array<int> > m_raw_action_counts;
-  Apto::Array<int> m_action_counts;
+  
   Apto::Array<Apto::String> m_action_ids;
   int m_num_enabled;
   Apto::Array<bool> m_enabled_actions;
   Apto::String m_enabled_action_string;
+  Apto::String m_front_action_string;     // enabled actions of the front buffer, returned by GetProperty()
   DiscreteScale::Entry m_scale_label_entry;
   Apto::String m_scale_label;
   const Apto::String m_name;
@@ -321,10 +374,6 @@ public:
   
   // MapMode Interface
   const Apto::String& GetName() const { return m_name; }
-  const Apto::Array<int>& GetGridValues() const { return m_action_grid; }
-  const Apto::Array<int>& GetValueCounts() const { return m_action_counts; }
-  
-  const DiscreteScale& GetScale() const { return *this; }
   const Apto::String& GetScaleLabel() const { return m_scale_label; }
   
   int GetSupportedTypes() const { return Avida::Viewer::MAP_GRID_VIEW_TAGS; }
@@ -333,6 +382,7 @@ public:
   Apto::String GetProperty(const Apto::String& property) const;
   
   void Update(cPopulation& pop);
+  void SwapBuffers() { BufferedMapMode::SwapBuffers(); m_front_action_string = m_enabled_action_string; }
   
   
   // DiscreteScale Interface
@@ -342,12 +392,12 @@ public:
   
   
 private:
-  void updateTagStates();
+  void updateTagStates(Buffer& buf);
 };
 
 
 EnvActionMapMode::EnvActionMapMode(cWorld* world)
- : m_world(world), m_action_counts(Avida::Viewer::MAP_RESERVED_COLORS), m_name("Actions")
+ : BufferedMapMode(0, Avida::Viewer::MAP_RESERVED_COLORS, 0), m_world(world), m_name("Actions")
 {
   cEnvironment& env = m_world->GetEnvironment();
   const int num_tasks = env.GetNumTasks();
@@ -383,7 +433,7 @@ bool EnvActionMapMode::SetProperty(const Apto::String& property, const Apto::Str
     m_num_enabled = num_enabled;
     m_enabled_actions = earr;
     m_enabled_action_string = value;
-    updateTagStates();
+    updateTagStates(backBuffer());
     return true;
   }
   return false;
@@ -397,7 +447,7 @@ Apto::String EnvActionMapMode::GetProperty(const Apto::String& property) const
     for (int i = 1; i < m_action_ids.GetSize(); i++) actionstr += Apto::String(",") + m_action_ids[i];
     return actionstr;
   } else if (property == "enabled_actions") {
-    return m_enabled_action_string;
+    return m_front_action_string;
   }
   
   return "";
@@ -407,39 +457,47 @@ void EnvActionMapMode::Update(cPopulation& pop)
 {
   cAvidaContext ctx(&m_world->GetDriver(), m_world->GetRandom());
 
-  m_action_grid.Resize(pop.GetSize());
-  m_raw_action_counts.Resize(pop.GetSize());
-  for (int i = 0; i < m_raw_action_counts.GetSize(); i++) m_raw_action_counts[i].Resize(m_action_ids.GetSize());
-  m_action_counts.SetAll(0);            // reset all color counts
+  if (m_cell_org_ids.GetSize() != pop.GetSize()) {
+    m_cell_org_ids.Resize(pop.GetSize());
+    m_cell_org_ids.SetAll(-2);
+    m_raw_action_counts.Resize(pop.GetSize());
+    for (int i = 0; i < m_raw_action_counts.GetSize(); i++) m_raw_action_counts[i].Resize(m_action_ids.GetSize());
+  }
   
   for (int i = 0; i < pop.GetSize(); i++) {
     cOrganism* org = pop.GetCell(i).GetOrganism();
+    const int org_id = (org) ? org->GetID() : -1;
+    if (m_cell_org_ids[i] == org_id) continue;
+    m_cell_org_ids[i] = org_id;
+    
     if (org == NULL) {
       m_raw_action_counts[i].SetAll(0);
     } else {
+//      if (org->GetPhenotype().GetLastTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 1;
+//      else if (org->GetPhenotype().GetCurTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 2;
+      Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
+      Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype));
+      const Apto::Array<int>& task_counts = metrics->GetTaskCounts();
       for (int task_id = 0; task_id < m_action_ids.GetSize(); task_id++) {
-//        if (org->GetPhenotype().GetLastTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 1;
-//        else if (org->GetPhenotype().GetCurTaskCount()[task_id] > 0) m_raw_action_counts[i][task_id] = 2;
-        Systematics::GroupPtr genotype = org->SystematicsGroup("genotype");
-        Systematics::GenomeTestMetricsPtr metrics(Systematics::GenomeTestMetrics::GetMetrics(m_world, ctx, genotype));
-        const Apto::Array<int>& task_counts = metrics->GetTaskCounts();
-        if (task_counts[task_id] > 0) m_raw_action_counts[i][task_id] = 1;
-        else m_raw_action_counts[i][task_id] = 0;
+        m_raw_action_counts[i][task_id] = (task_counts[task_id] > 0) ? 1 : 0;
       }
     }
   }
   
-  updateTagStates();
+  updateTagStates(backBuffer());
 }
 
 
-void EnvActionMapMode::updateTagStates()
+void EnvActionMapMode::updateTagStates(Buffer& buf)
 {
+  buf.grid.Resize(m_raw_action_counts.GetSize());
+  buf.counts.SetAll(0);            // reset all color counts
+  
   if (m_num_enabled == 0) {
-    m_action_grid.SetAll(-4);
+    buf.grid.SetAll(-4);
     return;
   }
-  for (int i = 0; i < m_action_grid.GetSize(); i++) {
+  for (int i = 0; i < buf.grid.GetSize(); i++) {
     int color = -1;
     for (int task_id = 0; task_id < m_action_ids.GetSize(); task_id++) {
       if (!m_enabled_actions[task_id]) continue;  // Task disabled, so ignore value
@@ -451,8 +509,8 @@ void EnvActionMapMode::updateTagStates()
       
       if (m_raw_action_counts[i][task_id] == 2) color = -3;  // One of the enabled tasks is a current task, so dim the tag
     }
-    m_action_grid[i] = color;
-    m_action_counts[4 + color]++;
+    buf.grid[i] = color;
+    buf.counts[4 + color]++;
   }
 }
 
@@ -465,6 +523,8 @@ Avida::Viewer::Map::Map(cWorld* world)
   , m_color_mode(0)
   , m_symbol_mode(-1)
   , m_tag_mode(4)
+  , m_population(&world->GetPopulation())
+  , m_population_idle(false)
 {
   // Setup the available view modes...
   m_view_modes.Resize(5);
@@ -474,6 +534,8 @@ Avida::Viewer::Map::Map(cWorld* world)
   m_view_modes[2] = new DoublePropMapMode(world, "last_metabolic_rate", "Metabolic Rate");
   m_view_modes[3] = new ClassificationMapMode(world, "clade", "Ancestor Organism");
   m_view_modes[4] = new EnvActionMapMode(world);
+  m_mode_current.Resize(m_view_modes.GetSize());
+  m_mode_current.SetAll(false);
 
   
 //  AddViewMode("Genome Length",  &cViewer_Map::SetColors_Length,   VIEW_COLOR, COLORS_SCALE);
@@ -500,32 +562,111 @@ Avida::Viewer::Map::~Map()
 
 bool Avida::Viewer::Map::SetModeProperty(int idx, const Apto::String& property, const Apto::String& value)
 {
-  m_rw_lock.WriteLock();
+  // Modes recompute their values into the back buffer when a property change succeeds
+  Apto::MutexAutoLock lock(m_update_mutex);
   bool rval = m_view_modes[idx]->SetProperty(property, value);
-  m_rw_lock.WriteUnlock();
+  if (rval) {
+    m_rw_lock.WriteLock();
+    m_view_modes[idx]->SwapBuffers();
+    m_rw_lock.WriteUnlock();
+  }
   return rval;
 }
 
+// Property values are only changed with the update mutex held, so reading them under it alone leaves the read lock
+// free for viewers that hold the map
+Apto::String Avida::Viewer::Map::GetModeProperty(int idx, const Apto::String& property) const
+{
+  Apto::MutexAutoLock lock(m_update_mutex);
+  return m_view_modes[idx]->GetProperty(property);
+}
+
 void Avida::Viewer::Map::UpdateMaps(cPopulation& pop)
 {
+  Apto::MutexAutoLock lock(m_update_mutex);
+  m_population = &pop;
+  
+  // The selected modes are only changed with the update mutex held
+  Apto::Array<int, Apto::Smart> modes;
+  activeModes(modes);
+  for (int i = 0; i < modes.GetSize(); i++) m_view_modes[modes[i]]->Update(pop);
+  
   m_rw_lock.WriteLock();
   
   m_width = pop.GetWorldX();
   m_height = pop.GetWorldY();
   
-  for (int i = 0; i < m_view_modes.GetSize(); i++) m_view_modes[i]->Update(pop);
+  for (int i = 0; i < modes.GetSize(); i++) m_view_modes[modes[i]]->SwapBuffers();
   
   m_rw_lock.WriteUnlock();
+  
+  // Modes that were not computed now lag behind the population
+  m_mode_current.SetAll(false);
+  for (int i = 0; i < modes.GetSize(); i++) m_mode_current[modes[i]] = true;
+}
+
+
+// Called by the driver, which only marks the population idle while it is waiting to be resumed.  Selected modes that
+// have fallen behind (e.g. the map was attached while paused) are computed right away.
+void Avida::Viewer::Map::SetPopulationIdle(bool idle)
+{
+  Apto::MutexAutoLock lock(m_update_mutex);
+  m_population_idle = idle;
+  if (!idle) return;
+  
+  Apto::Array<int, Apto::Smart> modes;
+  activeModes(modes);
+  computeStaleModes(modes);
 }
 
 
+// A newly selected mode is computed right away when the population is idle, and otherwise waits for the next map
+// update, since the population may be changing underneath it
 void Avida::Viewer::Map::SetMode(int mode)
 {
+  Apto::MutexAutoLock lock(m_update_mutex);
+  if (m_population_idle) {
+    Apto::Array<int, Apto::Smart> modes;
+    modes.Push(mode);
+    computeStaleModes(modes);
+  }
+  
   int type = m_view_modes[mode]->GetSupportedTypes();
+  m_rw_lock.WriteLock();
   if (type == MAP_GRID_VIEW_COLOR) m_color_mode = mode;
   else if (type == MAP_GRID_VIEW_SYMBOLS) m_symbol_mode = mode;
   else if (type == MAP_GRID_VIEW_TAGS) m_tag_mode = mode;
   else assert(false);
+  m_rw_lock.WriteUnlock();
+}
+
+
+void Avida::Viewer::Map::activeModes(Apto::Array<int, Apto::Smart>& modes) const
+{
+  const int selected[3] = { m_color_mode, m_symbol_mode, m_tag_mode };
+  for (int i = 0; i < 3; i++) {
+    if (selected[i] < 0) continue;
+    bool found = false;
+    for (int j = 0; j < modes.GetSize(); j++) if (modes[j] == selected[i]) found = true;
+    if (!found) modes.Push(selected[i]);
+  }
+}
+
+// Must be called with the update mutex held
+void Avida::Viewer::Map::computeStaleModes(const Apto::Array<int, Apto::Smart>& modes)
+{
+  Apto::Array<int, Apto::Smart> stale;
+  for (int i = 0; i < modes.GetSize(); i++) {
+    if (m_mode_current[modes[i]]) continue;
+    m_view_modes[modes[i]]->Update(*m_population);
+    m_mode_current[modes[i]] = true;
+    stale.Push(modes[i]);
+  }
+  if (stale.GetSize() == 0) return;
+  
+  m_rw_lock.WriteLock();
+  for (int i = 0; i < stale.GetSize(); i++) m_view_modes[stale[i]]->SwapBuffers();
+  m_rw_lock.WriteUnlock();
 }
 
 
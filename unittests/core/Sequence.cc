@@ -22,7 +22,121 @@
  *
  */
 
-#include "avida/core/Sequence.h"
+#include "avida/core/InstructionSequence.h"
 
 #include "gtest/gtest.h"
 
+using namespace Avida;
+
+
+TEST(InstructionSequence, ModifiedRangeStartsCoveringSequence) {
+  InstructionSequence seq("abcdef");
+  EXPECT_EQ(0, seq.GetModifiedBegin());
+  EXPECT_EQ(6, seq.GetModifiedEnd());
+  
+  seq.ClearModified();
+  EXPECT_GE(seq.GetModifiedBegin(), seq.GetModifiedEnd());
+}
+
+TEST(InstructionSequence, ModifiedRangeTracksWrites) {
+  InstructionSequence seq("abcdefgh");
+  seq.ClearModified();
+  
+  seq[5] = Instruction(0);
+  EXPECT_EQ(5, seq.GetModifiedBegin());
+  EXPECT_EQ(6, seq.GetModifiedEnd());
+  
+  seq.Copy(2, 7);
+  EXPECT_EQ(2, seq.GetModifiedBegin());
+  EXPECT_EQ(6, seq.GetModifiedEnd());
+}
+
+TEST(InstructionSequence, ModifiedRangeIgnoresConstReads) {
+  InstructionSequence seq("abcdefgh");
+  seq.ClearModified();
+  
+  const InstructionSequence& const_seq = seq;
+  EXPECT_EQ(Instruction(2), const_seq[2]);
+  EXPECT_GE(seq.GetModifiedBegin(), seq.GetModifiedEnd());
+}
+
+TEST(InstructionSequence, ModifiedRangeThroughBaseReference) {
+  InstructionSequence seq("abcdefgh");
+  seq.ClearModified();
+  
+  InstructionSequence& base = seq;
+  base[3] = Instruction(0);
+  EXPECT_EQ(3, seq.GetModifiedBegin());
+  EXPECT_EQ(4, seq.GetModifiedEnd());
+}
+
+TEST(InstructionSequence, ModifiedRangeCoversShiftedSites) {
+  InstructionSequence seq("abcdefgh");
+  seq.ClearModified();
+  seq.Insert(2, Instruction(25));
+  EXPECT_EQ(2, seq.GetModifiedBegin());
+  EXPECT_EQ(9, seq.GetModifiedEnd());
+  
+  seq.ClearModified();
+  seq.Remove(4, 2);
+  EXPECT_EQ(4, seq.GetModifiedBegin());
+  EXPECT_EQ(7, seq.GetModifiedEnd());
+  
+  seq.ClearModified();
+  seq.Replace(1, 1, InstructionSequence("xyz"));
+  EXPECT_EQ(1, seq.GetModifiedBegin());
+  EXPECT_EQ(seq.GetSize(), seq.GetModifiedEnd());
+}
+
+TEST(InstructionSequence, ModifiedRangeAfterRotateAndCircularReplace) {
+  InstructionSequence seq("abcdefgh");
+  seq.ClearModified();
+  seq.Rotate(3);
+  EXPECT_EQ("fghabcde", seq.AsString());
+  EXPECT_EQ(0, seq.GetModifiedBegin());
+  EXPECT_EQ(8, seq.GetModifiedEnd());
+  
+  seq.ClearModified();
+  seq.Replace(InstructionSequence("xyz"), 6, 1);
+  EXPECT_EQ("zghabcxy", seq.AsString());
+  EXPECT_EQ(0, seq.GetModifiedBegin());
+  EXPECT_EQ(8, seq.GetModifiedEnd());
+}
+
+
+TEST(InstructionSequence, CopyThenWriteLeavesOriginal) {
+  InstructionSequence seq("abcdef");
+  InstructionSequence copy(seq);
+  InstructionSequence assigned;
+  assigned = seq;
+  
+  copy[0] = Instruction(25);
+  assigned.Insert(3, Instruction(24));
+  EXPECT_EQ("abcdef", seq.AsString());
+  EXPECT_EQ("zbcdef", copy.AsString());
+  EXPECT_EQ("abcydef", assigned.AsString());
+  
+  seq.Remove(0, 2);
+  EXPECT_EQ("cdef", seq.AsString());
+  EXPECT_EQ("zbcdef", copy.AsString());
+  EXPECT_EQ("abcydef", assigned.AsString());
+}
+
+TEST(InstructionSequence, SelfInsertAndReplace) {
+  InstructionSequence seq("abcd");
+  seq.Insert(2, seq);
+  EXPECT_EQ("ababcdcd", seq.AsString());
+  
+  InstructionSequence shared("abcd");
+  InstructionSequence copy(shared);
+  shared.Insert(0, copy);
+  EXPECT_EQ("abcdabcd", shared.AsString());
+  EXPECT_EQ("abcd", copy.AsString());
+  
+  InstructionSequence replaced("abcd");
+  replaced.Replace(1, 2, replaced);
+  EXPECT_EQ("aabcdd", replaced.AsString());
+  
+  replaced.Replace(0, 6, replaced);
+  EXPECT_EQ("aabcdd", replaced.AsString());
+}
@@ -0,0 +1,105 @@
+/*
+ *  unittests/cpu/CPUMemory.cc
+ *  avida-core
+ *
+ *  Created on 10/19/26.
+ *  Copyright 2026 Michigan State University. All rights reserved.
+ *  http://avida.devosoft.org/
+ *
+ *
+ *  This file is part of Avida.
+ *
+ *  Avida is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License
+ *  as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  Avida is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public License along with Avida.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "cCPUMemory.h"
+
+#include "gtest/gtest.h"
+
+using namespace Avida;
+
+
+TEST(CPUMemory, ModifiedRangeTracksWrites) {
+  cCPUMemory memory(InstructionSequence("abcdefgh"));
+  memory.ClearModified();
+  
+  memory[6] = Instruction(0);
+  memory.SetFlagExecuted(1);
+  EXPECT_EQ(6, memory.GetModifiedBegin());
+  EXPECT_EQ(7, memory.GetModifiedEnd());
+  
+  memory.Insert(1, Instruction(25));
+  EXPECT_EQ(1, memory.GetModifiedBegin());
+  EXPECT_EQ(9, memory.GetModifiedEnd());
+}
+
+TEST(CPUMemory, ModifiedRangeThroughSequenceReference) {
+  cCPUMemory memory(InstructionSequence("abcdefgh"));
+  memory.ClearModified();
+  
+  InstructionSequence& seq = memory;
+  seq[2] = Instruction(0);
+  EXPECT_EQ(2, memory.GetModifiedBegin());
+  EXPECT_EQ(3, memory.GetModifiedEnd());
+  
+  memory.ClearModified();
+  seq.Rotate(2);
+  EXPECT_EQ("ghabadef", memory.AsString());
+  EXPECT_EQ(0, memory.GetModifiedBegin());
+  EXPECT_EQ(8, memory.GetModifiedEnd());
+}
+
+TEST(CPUMemory, ModifiedRangeAfterCircularReplace) {
+  cCPUMemory memory(InstructionSequence("abcdefgh"));
+  memory.ClearModified();
+  memory.Replace(InstructionSequence("xyz"), 6, 1);
+  EXPECT_EQ("zbcdefxy", memory.AsString());
+  EXPECT_EQ(0, memory.GetModifiedBegin());
+  EXPECT_EQ(8, memory.GetModifiedEnd());
+  
+  memory.ClearModified();
+  memory.Replace(InstructionSequence("xy"), 2, 5);
+  EXPECT_EQ("zbxyfxy", memory.AsString());
+  EXPECT_EQ(2, memory.GetModifiedBegin());
+  EXPECT_EQ(7, memory.GetModifiedEnd());
+}
+
+TEST(CPUMemory, ModifiedRangeIgnoresConstReads) {
+  cCPUMemory memory(InstructionSequence("abcdefgh"));
+  memory.ClearModified();
+  
+  const cCPUMemory& const_memory = memory;
+  EXPECT_EQ(Instruction(4), const_memory[4]);
+  EXPECT_GE(memory.GetModifiedBegin(), memory.GetModifiedEnd());
+}
+
+TEST(CPUMemory, ResizeOldAfterSharedWrite) {
+  cCPUMemory memory(InstructionSequence("abcdefgh"));
+  memory.Resize(4);
+  
+  // The write copies the shared storage, the sites past the active size must come with it
+  InstructionSequence copy(memory);
+  memory[0] = Instruction(25);
+  memory.ResizeOld(8);
+  EXPECT_EQ("zbcdefgh", memory.AsString());
+  EXPECT_EQ("abcd", copy.AsString());
+}
+
+TEST(CPUMemory, ResizeOldGrowingSharedStorage) {
+  cCPUMemory memory(InstructionSequence("abcdefgh"));
+  memory.Resize(4);
+  
+  // Growing past the capacity of shared storage moves the old sites into a larger buffer of our own
+  InstructionSequence copy(memory);
+  memory.ResizeOld(10);
+  EXPECT_EQ("abcdefghaa", memory.AsString());
+  EXPECT_EQ("abcd", copy.AsString());
+}